@@ -17,7 +17,12 @@
 #ifndef LIB_CPP_SPC_H
 #define LIB_CPP_SPC_H
 
+#include "Spc/BatchLoader.h"
+#include "Spc/BatchResult.h"
 #include "Spc/BinaryField.h"
+#include "Spc/Date.h"
+#include "Spc/ByteCursor.h"
+#include "Spc/ByteView.h"
 #include "Spc/DataStructure.h"
 #include "Spc/DateField.h"
 #include "Spc/EmulatorField.h"
@@ -26,19 +31,35 @@
 #include "Spc/File.h"
 #include "Spc/Format.h"
 #include "Spc/Header.h"
+#include "Spc/Layout.h"
+#include "Spc/LoadMode.h"
+#include "Spc/MappedFile.h"
+#include "Spc/ProbeResult.h"
 #include "Spc/NumericField.h"
+#include "Spc/NumberFormat.h"
 #include "Spc/NumericType.h"
+#include "Spc/OnceFlag.h"
 #include "Spc/TextField.h"
 #include "Spc/TrackField.h"
+#include "Spc/TransferMode.h"
+#include "Spc/Id666/FieldDescriptor.h"
 #include "Spc/Id666/Tag.h"
+#include "Spc/Id666/TagRecord.h"
 #include "Spc/Id666/TagType.h"
 #include "Spc/Id666/Extended/Data.h"
 #include "Spc/Id666/Extended/Item.h"
+#include "Spc/Id666/Extended/ItemTable.h"
+#include "Spc/Id666/Extended/ItemParser.h"
 #include "Spc/Id666/Pattern/Token.h"
 #include "Spc/Id666/Pattern/TokenType.h"
 #include "Spc/Id666/Pattern/Lexer.h"
 #include "Spc/Id666/Pattern/Node.h"
 #include "Spc/Id666/Pattern/NodeType.h"
 #include "Spc/Id666/Pattern/Parser.h"
+#include "Spc/Id666/Pattern/Placeholder.h"
+#include "Spc/Id666/Pattern/FormatSpec.h"
+#include "Spc/Id666/Pattern/Capture.h"
+#include "Spc/Id666/Pattern/Segment.h"
+#include "Spc/Id666/Pattern/Compiled.h"
 
 #endif
\ No newline at end of file
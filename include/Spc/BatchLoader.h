@@ -0,0 +1,109 @@
+// BatchLoader.h - Declares the Spc::BatchLoader class.
+//
+// Copyright (C) 2026 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef SPC_BATCH_LOADER_H
+#define SPC_BATCH_LOADER_H
+
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <vector>
+#include "BatchResult.h"
+#include "LoadMode.h"
+
+namespace Spc
+{
+    /// @brief Loads many SPC files in parallel on a pool of worker threads.
+    ///
+    /// Each file is loaded with its own Spc::File, so files never share state
+    /// and a failure in one file is reported in that file's result without
+    /// affecting the others.
+    class BatchLoader
+    {
+    public:
+        /// @brief Called once for each file as soon as it has been loaded.
+        using Callback = std::function<void(BatchResult result)>;
+
+        /// @brief Constructor; creates a loader with the specified settings.
+        /// @param workers The number of worker threads, or 0 for one per core.
+        /// @param mode The mode each file is loaded with.
+        explicit BatchLoader(size_t workers = 0, 
+                             LoadMode mode = LoadMode::Buffered);
+
+        /// @brief Gets the number of worker threads used to load files.
+        /// @return The number of worker threads.
+        size_t Workers() const { return workers; }
+
+        /// @brief Gets the mode each file is loaded with.
+        /// @return The Spc::LoadMode used to load each file.
+        LoadMode Mode() const { return mode; }
+
+        /// @brief Loads the files at the specified paths.
+        ///
+        /// The callback runs on the worker threads as files finish loading, 
+        /// so results arrive in completion order rather than in the order of 
+        /// the paths. Calls to the callback never overlap, so it does not need
+        /// its own locking. If the callback throws, no new files are started 
+        /// and the exception is rethrown once the workers have stopped.
+        ///
+        /// @param paths The paths of the files to load.
+        /// @param callback The function to receive each file's result.
+        /// @throws std::system_error if a worker thread cannot be started.
+        void Load(const std::vector<std::string>& paths, 
+                  const Callback& callback) const;
+
+        /// @brief Loads the files at the specified paths.
+        /// @param paths The paths of the files to load.
+        /// @return The result for each file, in the same order as the paths.
+        /// @throws std::system_error if a worker thread cannot be started.
+        std::vector<BatchResult> Load(
+            const std::vector<std::string>& paths) const;
+
+        /// @brief Loads every SPC file in a directory.
+        /// @param directory The path of the directory to search.
+        /// @param recursive True to also search subdirectories.
+        /// @param callback The function to receive each file's result.
+        /// @throws FileOperationException if the directory cannot be read.
+        /// @see Load() for when the callback is called.
+        void LoadDirectory(const std::string& directory, 
+                           bool recursive,
+                           const Callback& callback) const;
+
+        /// @brief Finds every SPC file in a directory.
+        ///
+        /// A file is considered an SPC file if its extension is ".spc", 
+        /// ignoring case. The paths are sorted so the order is stable.
+        ///
+        /// @param directory The path of the directory to search.
+        /// @param recursive True to also search subdirectories.
+        /// @return The paths of the SPC files that were found.
+        /// @throws FileOperationException if the directory cannot be read.
+        static std::vector<std::string> FindFiles(const std::string& directory,
+                                                  bool recursive);
+    private:
+        size_t workers;
+        LoadMode mode;
+
+        /// @brief Loads the files on the worker threads.
+        /// @param paths The paths of the files to load.
+        /// @param callback The function to receive each path's index and 
+        /// result, called with a lock held.
+        void Run(const std::vector<std::string>& paths, 
+                 const std::function<void(size_t, BatchResult)>& callback) const;
+    };
+}
+
+#endif
@@ -0,0 +1,51 @@
+// BatchResult.h - Declares the Spc::BatchResult struct.
+//
+// Copyright (C) 2026 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef SPC_BATCH_RESULT_H
+#define SPC_BATCH_RESULT_H
+
+#include <exception>
+#include <memory>
+#include <string>
+#include "File.h"
+
+namespace Spc
+{
+    /// @brief The outcome of loading one file as part of a batch.
+    ///
+    /// Exactly one of file and error is set. Errors are kept per file, so a
+    /// corrupt or unreadable file never stops the rest of the batch.
+    struct BatchResult
+    {
+        /// @brief The path of the file that was loaded.
+        std::string path;
+
+        /// @brief The loaded file, or nullptr if loading failed.
+        std::shared_ptr<File> file;
+
+        /// @brief The exception thrown while loading, or nullptr on success.
+        ///
+        /// This is typically a FileCorruptException or FileOperationException,
+        /// and can be rethrown with std::rethrow_exception().
+        std::exception_ptr error;
+
+        /// @brief Determines if the file was loaded successfully.
+        /// @return True if the file was loaded, otherwise false.
+        bool Succeeded() const { return error == nullptr; }
+    };
+}
+
+#endif
@@ -0,0 +1,89 @@
+// ByteCursor.h - Declares the Spc::ByteCursor class.
+//
+// Copyright (C) 2026 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef SPC_BYTE_CURSOR_H
+#define SPC_BYTE_CURSOR_H
+
+#include <cstdint>
+#include <cstddef>
+#include "ByteView.h"
+
+namespace Spc
+{
+    /// @brief Reads values sequentially from a view of bytes.
+    ///
+    /// Every read is bounds-checked against the view, so a cursor can be used
+    /// to parse untrusted file data without risk of reading past the end.
+    /// Multi-byte integers are read in little endian byte order, which is the
+    /// byte order used throughout SPC files.
+    class ByteCursor
+    {
+    public:
+        /// @brief Constructor; creates a cursor at the start of the bytes.
+        /// @param bytes The bytes to read from.
+        explicit ByteCursor(ByteView bytes) : bytes{ bytes }, position{ 0 } { }
+
+        /// @brief Gets the position of the cursor within the bytes.
+        /// @return The offset of the next byte to be read.
+        size_t Position() const { return position; }
+
+        /// @brief Gets the number of bytes left to read.
+        /// @return The number of bytes between the cursor and the end.
+        size_t Remaining() const { return bytes.Size() - position; }
+
+        /// @brief Moves the cursor to the specified position.
+        /// @param p The offset to move the cursor to.
+        /// @throws FileCorruptException if the position is past the end.
+        void Seek(size_t p);
+
+        /// @brief Moves the cursor forward without reading.
+        /// @param count The number of bytes to skip.
+        /// @throws FileCorruptException if fewer bytes remain.
+        void Skip(size_t count);
+
+        /// @brief Reads the specified number of bytes as a view.
+        /// @param count The number of bytes to read.
+        /// @return The view of the bytes that were read.
+        /// @throws FileCorruptException if fewer bytes remain.
+        ByteView Read(size_t count);
+
+        /// @brief Copies the specified number of bytes to a destination.
+        /// @param destination The buffer to copy the bytes to.
+        /// @param count The number of bytes to copy.
+        /// @throws FileCorruptException if fewer bytes remain.
+        void CopyTo(char* destination, size_t count);
+
+        /// @brief Reads an unsigned 8-bit integer.
+        /// @return The integer that was read.
+        /// @throws FileCorruptException if fewer bytes remain.
+        uint8_t ReadUInt8();
+
+        /// @brief Reads a little endian unsigned 16-bit integer.
+        /// @return The integer that was read.
+        /// @throws FileCorruptException if fewer bytes remain.
+        uint16_t ReadUInt16();
+
+        /// @brief Reads a little endian unsigned 32-bit integer.
+        /// @return The integer that was read.
+        /// @throws FileCorruptException if fewer bytes remain.
+        uint32_t ReadUInt32();
+    private:
+        ByteView bytes;
+        size_t position;
+    };
+}
+
+#endif
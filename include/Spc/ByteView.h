@@ -0,0 +1,95 @@
+// ByteView.h - Declares the Spc::ByteView class.
+//
+// Copyright (C) 2026 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef SPC_BYTE_VIEW_H
+#define SPC_BYTE_VIEW_H
+
+#include <cstddef>
+#include <stdexcept>
+#include "FieldInfo.h"
+
+namespace Spc
+{
+    /// @brief A read-only, non-owning view of a contiguous range of bytes.
+    ///
+    /// The view does not own the bytes it refers to, so the caller must
+    /// ensure the underlying storage outlives the view.
+    class ByteView
+    {
+    public:
+        /// @brief Constructor; creates an empty view.
+        constexpr ByteView() : data{ nullptr }, size{ 0 } { }
+
+        /// @brief Constructor; creates a view of the specified bytes.
+        /// @param d Pointer to the first byte in the view.
+        /// @param s The number of bytes in the view.
+        constexpr ByteView(const char* d, size_t s) : data{ d }, size{ s } { }
+
+        /// @brief Gets a pointer to the first byte in the view.
+        /// @return The pointer to the first byte.
+        constexpr const char* Data() const { return data; }
+
+        /// @brief Gets the number of bytes in the view.
+        /// @return The size of the view in bytes.
+        constexpr size_t Size() const { return size; }
+
+        /// @brief Determines if the view contains no bytes.
+        /// @return True if the view is empty, otherwise false.
+        constexpr bool Empty() const { return size == 0; }
+
+        /// @brief Gets the byte at the specified index without bounds checks.
+        /// @param index The index of the byte to get.
+        /// @return The byte at the specified index.
+        constexpr char operator[](size_t index) const { return data[index]; }
+
+        /// @brief Gets an iterator to the first byte in the view.
+        /// @return The pointer to the first byte.
+        constexpr const char* begin() const { return data; }
+
+        /// @brief Gets an iterator one past the last byte in the view.
+        /// @return The pointer one past the last byte.
+        constexpr const char* end() const { return data + size; }
+
+        /// @brief Gets a view of a sub range of this view.
+        /// @param offset The offset of the sub range within this view.
+        /// @param count The number of bytes in the sub range.
+        /// @return The view of the sub range.
+        /// @throws std::out_of_range if the range exceeds the view.
+        ByteView Subview(size_t offset, size_t count) const
+        {
+            if (offset > size || count > size - offset)
+            {
+                throw std::out_of_range("Byte range exceeds the view.");
+            }
+
+            return ByteView{ data + offset, count };
+        }
+
+        /// @brief Gets a view of the bytes described by the field info.
+        /// @param info The offset and size of the bytes to view.
+        /// @return The view of the field's bytes.
+        /// @throws std::out_of_range if the field exceeds the view.
+        ByteView Subview(FieldInfo info) const
+        {
+            return Subview(info.offset, info.size);
+        }
+    private:
+        const char* data;
+        size_t size;
+    };
+}
+
+#endif
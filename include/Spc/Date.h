@@ -0,0 +1,116 @@
+// Date.h - Declares the Spc::Date struct.
+//
+// Copyright (C) 2026 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef SPC_DATE_H
+#define SPC_DATE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+
+namespace Spc
+{
+    /// @brief A calendar date, such as the date an SPC file was dumped.
+    struct Date
+    {
+        /// @brief The number of characters in a date in MM/DD/YYYY format.
+        static constexpr size_t textSize{ 10 };
+
+        /// @brief The year, such as 2000.
+        uint16_t year{ 0 };
+
+        /// @brief The month, from 1 to 12.
+        uint8_t month{ 0 };
+
+        /// @brief The day of the month, from 1 to 31.
+        uint8_t day{ 0 };
+
+        /// @brief Determines if the date exists on the calendar.
+        ///
+        /// The year must fit in the four digits of the MM/DD/YYYY format and
+        /// the day must exist in the month, taking leap years into account.
+        ///
+        /// @return True if the date is valid, otherwise false.
+        constexpr bool IsValid() const
+        {
+            constexpr uint16_t maxYear{ 9999 };
+            constexpr uint8_t maxMonth{ 12 };
+
+            if (year > maxYear || month < 1 || month > maxMonth || day < 1)
+            {
+                return false;
+            }
+
+            constexpr uint8_t daysInMonth[]{ 
+                31, 29, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31 
+            };
+            constexpr uint8_t february{ 2 };
+            bool isLeapYear = (year % 4 == 0 && year % 100 != 0) || 
+                              year % 400 == 0;
+
+            if (month == february && !isLeapYear)
+            {
+                return day < daysInMonth[month - 1];
+            }
+
+            return day <= daysInMonth[month - 1];
+        }
+
+        /// @brief Writes the date in MM/DD/YYYY format.
+        /// @param destination The buffer to write to, which must hold at 
+        ///                    least textSize characters.
+        /// @pre The date must be valid.
+        void Format(char* destination) const;
+
+        /// @brief Gets the date in MM/DD/YYYY format.
+        /// @return The string representation of the date.
+        /// @pre The date must be valid.
+        std::string ToString() const;
+
+        /// @brief Parses a date in MM/DD/YYYY format.
+        ///
+        /// The month and day may be a single digit and trailing whitespace is
+        /// ignored. Parsing does not depend on the locale and doesn't 
+        /// allocate.
+        ///
+        /// @param text The text to parse.
+        /// @return The date, or std::nullopt if the text is not in MM/DD/YYYY
+        ///         format or is not a valid date.
+        static std::optional<Date> Parse(std::string_view text);
+    };
+
+    /// @brief Determines if two dates are the same date.
+    /// @param a The first date to compare.
+    /// @param b The second date to compare.
+    /// @return True if the dates are equal, otherwise false.
+    constexpr bool operator==(const Date& a, const Date& b)
+    {
+        return a.year == b.year && a.month == b.month && a.day == b.day;
+    }
+
+    /// @brief Determines if two dates are different dates.
+    /// @param a The first date to compare.
+    /// @param b The second date to compare.
+    /// @return True if the dates are not equal, otherwise false.
+    constexpr bool operator!=(const Date& a, const Date& b)
+    {
+        return !(a == b);
+    }
+}
+
+#endif
@@ -17,11 +17,10 @@
 #ifndef SPC_DATE_FIELD_H
 #define SPC_DATE_FIELD_H
 
+#include <optional>
 #include <string>
-#include <sstream>
-#include <ctime>
-#include <iomanip>
 #include <stdexcept>
+#include "Date.h"
 #include "NumericField.h"
 #include "FieldInfo.h"
 #include "Format.h"
@@ -57,26 +56,47 @@ namespace Spc
         /// @return Returns true if it is set, otherwise false.
         bool IsSet() const;
 
+        /// @brief Gets the date the field represents.
+        /// @return The date, or std::nullopt if the field is not set or does
+        ///         not contain a valid date.
+        std::optional<Date> ToDate() const;
+
         /// @brief Sets the date value using a string representation of date.
         /// @param value The date value as a string.
-        /// @pre The value should be in MM/DD/YYYY format.
+        /// @pre The value should be a valid date in MM/DD/YYYY format.
         /// @post The field's data is updated to represent the specified value.
+        /// @throws std::invalid_argument if the value is not a valid date in
+        ///         MM/DD/YYYY format.
         virtual void SetValue(const std::string& value) override;
 
+        /// @brief Sets the date value without parsing it from a string.
+        ///
+        /// The date is stored as text unless the field's type is binary, just
+        /// like SetValue().
+        ///
+        /// @param date The date to set.
+        /// @post The field's data is updated to represent the specified date.
+        /// @throws std::invalid_argument if the date is not valid.
+        void SetDate(const Date& date);
+
         /// @copydoc Field::ToString()
         virtual std::string ToString() const override;
     private:
+        /// @brief Gets the day, month and year from the binary format bytes.
+        /// @return The date the bytes represent, which may not be valid.
+        Date BinaryDate() const;
+
         /// @brief Sets the date value and stores it in text format.
-        /// @param value The date value as a string.
-        /// @pre The value should be in MM/DD/YYYY format.
-        /// @post The field's data is updated to represent the specified value.
-        void SetTextValue(const std::string& value);
+        /// @param date The date to store.
+        /// @pre The date must be valid.
+        /// @post The field's data is updated to represent the specified date.
+        void SetTextDate(const Date& date);
 
         /// @brief Sets the date value and stores it in binary format.
-        /// @param value The date value as a string.
-        /// @pre The value should be in MM/DD/YYYY format.
-        /// @post The field's data is updated to represent the specified value.
-        void SetBinaryValue(const std::string& value);
+        /// @param date The date to store.
+        /// @pre The date must be valid.
+        /// @post The field's data is updated to represent the specified date.
+        void SetBinaryDate(const Date& date);
     };
 }
 
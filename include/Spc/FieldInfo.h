@@ -68,6 +68,12 @@ namespace Spc
     /// @brief Defines the offset and size of the SPC RAM dump.
     inline constexpr FieldInfo ramInfo{ 0x100, 65536 };
 
+    /// @brief The size of a page of SPC700 RAM, in bytes.
+    inline constexpr size_t ramPageSize{ 256 };
+
+    /// @brief The number of pages in the SPC RAM dump.
+    inline constexpr size_t ramPageCount{ ramInfo.size / ramPageSize };
+
     /// @brief Defines the offset and size of the DSP registers.
     inline constexpr FieldInfo dspRegistersInfo{ 0x10100, 128 };
 
@@ -17,15 +17,26 @@
 #ifndef SPC_FILE_H
 #define SPC_FILE_H
 
+#include <bitset>
 #include <string>
+#include <utility>
 #include <vector>
 #include <LibCppBinary.h>
 #include <filesystem>
+#include "Spc/ByteCursor.h"
+#include "Spc/ByteView.h"
 #include "Spc/Header.h"
+#include "Spc/Layout.h"
+#include "Spc/LoadMode.h"
+#include "Spc/MappedFile.h"
+#include "Spc/OnceFlag.h"
+#include "Spc/ProbeResult.h"
+#include "Spc/TransferMode.h"
 #include "Spc/Id666/Tag.h"
 #include "Spc/Id666/Pattern/Lexer.h"
 #include "Spc/Id666/Pattern/Constants.h"
 #include "Spc/Id666/Pattern/Parser.h"
+#include "Spc/Id666/Pattern/Compiled.h"
 #include "Spc/Id666/Extended/Data.h"
 #include "Spc/Id666/Extended/Item.h"
 #include "Spc/FileCorruptException.h"
@@ -36,6 +47,15 @@ namespace Spc
     /// @brief Represents an SPC file.
     ///
     /// This class is used for reading and writing to and from SPC files.
+    ///
+    /// Header() and the section accessors, such as Ram() and RamView(), may
+    /// be called on the same file from more than one thread at a time. A
+    /// file loaded with LoadMode::Mapped copies its sections out of the
+    /// mapping the first time one is requested, and that copy is guarded so
+    /// it runs exactly once. Anything that loads, saves or modifies the file
+    /// needs external synchronization with every other call, and so does
+    /// anything that reads the tag, because Id666::Tag's const methods are
+    /// not thread-safe.
     class File
     {
     public:
@@ -51,7 +71,8 @@ namespace Spc
             dspRegisters{ dspRegistersInfo.size }, 
             unused{ unusedInfo.size }, 
             extraRam{ extraRamInfo.size },
-            fileStream{ nullptr }
+            fileStream{ nullptr },
+            ownsStream{ true }
         { 
             fileStream = std::make_shared<Binary::StandardFileStream>(path);
         }
@@ -74,78 +95,336 @@ namespace Spc
              fileStream{ stream }
         { }
 
+        /// @brief Constructor; creates an SPC file from bytes in memory.
+        ///
+        /// The file has no path or file stream, so it never touches the 
+        /// filesystem. Use Save(std::vector<char>&) to serialize it again.
+        ///
+        /// @param bytes The bytes of a whole SPC file.
+        /// @throws FileCorruptException if the bytes are not a valid SPC file.
+        explicit File(ByteView bytes) :
+            ram{ ramInfo.size },
+            dspRegisters{ dspRegistersInfo.size },
+            unused{ unusedInfo.size },
+            extraRam{ extraRamInfo.size },
+            fileStream{ nullptr }
+        {
+            Load(bytes);
+        }
+
+        /// @brief Checks whether bytes look like the start of an SPC file.
+        ///
+        /// Only the first 0x100 bytes are inspected: the header ID, separator
+        /// and contains tag flag, and the tag type if the tag is present. No 
+        /// memory is allocated and no Spc::File is constructed.
+        ///
+        /// @param bytes The bytes at the start of the file.
+        /// @return A Spc::ProbeResult describing what was found.
+        static ProbeResult Probe(ByteView bytes);
+
+        /// @brief Checks whether a file on disk looks like an SPC file.
+        ///
+        /// Reads at most the first 0x100 bytes of the file with a single read
+        /// into a buffer on the stack, then probes them.
+        ///
+        /// @param path The path to the file on disk.
+        /// @return A Spc::ProbeResult describing what was found.
+        /// @throws FileOperationException if the file cannot be opened or read.
+        static ProbeResult Probe(const std::string& path);
+
         /// @brief Gets the path to the SPC file on disk.
         /// @return The string representation of the file path.
         std::string Path() const { return path; }
 
         /// @brief Gets the header of the SPC file.
         /// @return A Spc::Header object representing the header.
-        Spc::Header Header() const { return header; }
+        const Spc::Header& Header() const { return header; }
 
         /// @brief Gets the ID666 tag of the SPC file.
         /// @return A Spc::Id666::Tag object representing the tag.
-        Spc::Id666::Tag Tag() const { return tag; }
+        const Spc::Id666::Tag& Tag() const { return tag; }
 
         /// @brief Gets the SPC RAM dump contained within the file.
+        ///
+        /// The reference is to the file's own buffer, so returning it copies
+        /// nothing. The one exception is a file loaded with LoadMode::Mapped:
+        /// the first call to this or any other section accessor copies all
+        /// four sections out of the mapping, once, even when several threads
+        /// make that first call together. Use RamView() to read a mapped file
+        /// without copying at all. The reference is only valid until the file
+        /// is modified, loaded or destroyed.
+        ///
         /// @return A Binary::BufferStream containing the RAM dump.
-        Binary::BufferStream Ram() const { return ram; }
+        /// @throws FileOperationException if the file was loaded with
+        /// LoadMode::Metadata and the RAM dump has not been set since.
+        const Binary::BufferStream& Ram() const 
+        { 
+            return Section(ram, ramIndex); 
+        }
 
         /// @brief Gets the DSP registers contained within the SPC file.
         /// @return A Binary::BufferStream containing the DSP registers.
-        Binary::BufferStream DspRegisters() const { return dspRegisters; }
+        /// @throws FileOperationException if the section was not loaded.
+        /// @see Ram() for when the sections are copied and the lifetime of
+        /// the reference.
+        const Binary::BufferStream& DspRegisters() const 
+        { 
+            return Section(dspRegisters, dspRegistersIndex); 
+        }
 
         /// @brief Gets the unused portion of the SPC file.
         /// @return A Binary::BufferStream containing the unused portion.
-        Binary::BufferStream Unused() const { return unused; }
+        /// @throws FileOperationException if the section was not loaded.
+        /// @see Ram() for when the sections are copied and the lifetime of
+        /// the reference.
+        const Binary::BufferStream& Unused() const 
+        { 
+            return Section(unused, unusedIndex); 
+        }
 
         /// @brief Gets the extra RAM contained within the SPC file.
         /// @return A Binary::BufferStream containing the extra RAM.
-        Binary::BufferStream ExtraRam() const { return extraRam; }
+        /// @throws FileOperationException if the section was not loaded.
+        /// @see Ram() for when the sections are copied and the lifetime of
+        /// the reference.
+        const Binary::BufferStream& ExtraRam() const 
+        { 
+            return Section(extraRam, extraRamIndex); 
+        }
+
+        /// @brief Gets a read-only view of the SPC RAM dump.
+        ///
+        /// When the file was loaded with LoadMode::Mapped, the view points 
+        /// directly into the mapped file. Otherwise, it points into the file's
+        /// own buffer. Either way, the view is only valid until the file is 
+        /// modified, loaded, saved or destroyed.
+        ///
+        /// @return A Spc::ByteView of the RAM dump.
+        /// @throws FileOperationException if the file was loaded with
+        /// LoadMode::Metadata and the RAM dump has not been set since.
+        ByteView RamView() const 
+        { 
+            return SectionView(ram, ramInfo, ramIndex); 
+        }
+
+        /// @brief Gets a read-only view of the DSP registers.
+        /// @return A Spc::ByteView of the DSP registers.
+        /// @throws FileOperationException if the section was not loaded.
+        /// @see RamView() for the lifetime of the view.
+        ByteView DspRegistersView() const 
+        { 
+            return SectionView(dspRegisters, 
+                               dspRegistersInfo, 
+                               dspRegistersIndex); 
+        }
+
+        /// @brief Gets a read-only view of the unused portion of the file.
+        /// @return A Spc::ByteView of the unused portion.
+        /// @throws FileOperationException if the section was not loaded.
+        /// @see RamView() for the lifetime of the view.
+        ByteView UnusedView() const 
+        { 
+            return SectionView(unused, unusedInfo, unusedIndex); 
+        }
+
+        /// @brief Gets a read-only view of the extra RAM.
+        /// @return A Spc::ByteView of the extra RAM.
+        /// @throws FileOperationException if the section was not loaded.
+        /// @see RamView() for the lifetime of the view.
+        ByteView ExtraRamView() const 
+        { 
+            return SectionView(extraRam, extraRamInfo, extraRamIndex); 
+        }
+
+        /// @brief Gets a read-only view of the raw ID666 tag bytes.
+        ///
+        /// When the file was loaded with LoadMode::Mapped, the view points to
+        /// the tag as it is stored in the mapped file, so changes made through
+        /// a Spc::Id666::Tag are not visible until the file is saved.
+        ///
+        /// @return A Spc::ByteView of the tag bytes.
+        /// @see RamView() for the lifetime of the view.
+        ByteView TagView() const;
+
+        /// @brief Determines if the file's sections are views into a mapping.
+        /// @return True if loaded with LoadMode::Mapped, otherwise false.
+        bool IsMapped() const { return mapping != nullptr; }
+
+        /// @brief Determines if the RAM and register sections are available.
+        ///
+        /// A file loaded with LoadMode::Metadata has none of its sections
+        /// until each of them has been set with SetRam(), SetDspRegisters(),
+        /// SetUnused() and SetExtraRam().
+        ///
+        /// @return True if every section was loaded or set, otherwise false.
+        bool HasSections() const { return loadedSections.all(); }
+
+        /// @brief Determines if the file has changed since it was last loaded.
+        /// @return True if Save() has something to write, otherwise false.
+        bool IsModified() const;
 
         /// @brief Sets the header of the SPC file.
         /// @param h The Spc::Header object to set.
-        void SetHeader(const Spc::Header& h) { header = h; }
+        void SetHeader(const Spc::Header& h);
+
+        /// @brief Sets the header of the SPC file, taking ownership of it.
+        /// @param h The Spc::Header object to move from.
+        void SetHeader(Spc::Header&& h);
 
         /// @brief Sets the ID666 tag of the SPC file.
         /// @param t The Spc::Id666::Tag object to set.
         void SetTag(const Spc::Id666::Tag& t) { tag = t; }
 
+        /// @brief Sets the ID666 tag of the SPC file, taking ownership of it.
+        /// @param t The Spc::Id666::Tag object to move from.
+        void SetTag(Spc::Id666::Tag&& t) { tag = std::move(t); }
+
         /// @brief Sets the SPC RAM dump contained within the file.
         /// @param r The Binary::BufferStream containing the RAM dump.
-        void SetRam(const Binary::BufferStream& r) { ram = r; }
+        void SetRam(const Binary::BufferStream& r);
+
+        /// @brief Sets the SPC RAM dump, taking ownership of the buffer.
+        /// @param r The Binary::BufferStream to move from.
+        void SetRam(Binary::BufferStream&& r);
 
         /// @brief Sets the DSP registers contained within the SPC file.
         /// @param d The Binary::BufferStream containing the DSP registers.
-        void SetDspRegisters(const Binary::BufferStream& d) 
-        {
-            dspRegisters = d; 
-        }
+        void SetDspRegisters(const Binary::BufferStream& d);
+
+        /// @brief Sets the DSP registers, taking ownership of the buffer.
+        /// @param d The Binary::BufferStream to move from.
+        void SetDspRegisters(Binary::BufferStream&& d);
 
         /// @brief Sets the unused portion of the SPC file.
         /// @param u The Binary::BufferStream containing the unused portion.
-        void SetUnused(const Binary::BufferStream& u) { unused = u; }
+        void SetUnused(const Binary::BufferStream& u);
+
+        /// @brief Sets the unused portion, taking ownership of the buffer.
+        /// @param u The Binary::BufferStream to move from.
+        void SetUnused(Binary::BufferStream&& u);
 
         /// @brief Sets the extra RAM contained within the SPC file.
         /// @param e The Binary::BufferStream containing the extra RAM.
-        void SetExtraRam(const Binary::BufferStream& e) { extraRam = e; }
+        void SetExtraRam(const Binary::BufferStream& e);
+
+        /// @brief Sets the extra RAM, taking ownership of the buffer.
+        /// @param e The Binary::BufferStream to move from.
+        void SetExtraRam(Binary::BufferStream&& e);
+
+        /// @brief Overwrites part of the SPC RAM dump.
+        ///
+        /// Only the RAM pages touched by the bytes are marked as changed, so 
+        /// Save() writes just those pages back to disk.
+        ///
+        /// @param offset The offset within the RAM dump to write to.
+        /// @param bytes The bytes to write.
+        /// @throws FileOperationException if the RAM dump was not loaded.
+        /// @throws std::out_of_range if the bytes do not fit in the RAM dump.
+        void PatchRam(size_t offset, ByteView bytes);
+
+        /// @brief Overwrites some of the DSP registers.
+        /// @param offset The offset within the DSP registers to write to.
+        /// @param bytes The bytes to write.
+        /// @throws FileOperationException if the registers were not loaded.
+        /// @throws std::out_of_range if the bytes do not fit in the registers.
+        void PatchDspRegisters(size_t offset, ByteView bytes);
 
         /// @brief Loads the SPC file from disk.
         /// @pre The file path points to a valid SPC file that exists.
         /// @post The file's data is loaded into the class data.
         /// @throws FileOperationException if the file cannot be opened or read.
         /// @throws FileCorruptException if the file is not a valid SPC file.
-        void Load();
+        void Load() { Load(LoadMode::Stream); }
+
+        /// @brief Loads the SPC file from disk using the specified mode.
+        ///
+        /// LoadMode::Mapped maps the file at Path() into memory rather than
+        /// reading it through the file stream. The mapping is kept until the
+        /// file is modified, loaded again, saved or destroyed; sections that
+        /// were only viewed are copied into the file's own buffers first.
+        ///
+        /// LoadMode::Metadata reads only the header, tag and extended data.
+        /// The remaining sections are never read, so their accessors throw
+        /// until they are set, but since Save() only writes what changed, such
+        /// a file can still be saved safely.
+        ///
+        /// LoadMode::Buffered reads the whole file through the file stream in
+        /// a single read, then parses every section from that buffer.
+        ///
+        /// @param mode The mode that determines how the file is loaded.
+        /// @pre The file path points to a valid SPC file that exists.
+        /// @post The file's data is loaded into the class data.
+        /// @throws FileOperationException if the file cannot be opened or read.
+        /// @throws FileCorruptException if the file is not a valid SPC file.
+        void Load(LoadMode mode);
+
+        /// @brief Loads the SPC file from bytes in memory.
+        ///
+        /// Every section is copied out of the bytes, so they do not need to 
+        /// outlive the file. Since the bytes may not match what is on disk, 
+        /// the next call to Save() writes the whole file.
+        ///
+        /// @param bytes The bytes of a whole SPC file.
+        /// @post The file's data is loaded into the class data.
+        /// @throws FileCorruptException if the bytes are not a valid SPC file.
+        void Load(ByteView bytes);
 
         /// @brief Saves the SPC file to disk.
+        ///
+        /// A file that has not been loaded or saved yet is written out in 
+        /// full. Otherwise, the file keeps track of what changed since then 
+        /// (the header, tag, individual RAM pages, DSP registers, unused area, 
+        /// extra RAM and extended data) and only those byte ranges are written,
+        /// in place. If nothing changed, the file is not touched at all. A 
+        /// file on disk too short to hold every section is written in full.
+        ///
         /// @pre The file path points to a valid SPC file that exists.
         /// @post The file on disk is overwritten with the class data.
         /// @throws FileOperationException if the file cannot open or write.
+        /// @throws FileCorruptException if the file is too small to patch and
+        ///         was loaded without its sections.
         void Save();
 
+        /// @brief Gets the number of bytes the whole SPC file occupies.
+        /// @return The size of the file as Save(char*, size_t) writes it.
+        size_t SerializedSize() const;
+
+        /// @brief Saves the whole SPC file into a buffer in memory.
+        /// @param buffer The buffer to write to; resized to fit the file.
+        /// @post The buffer holds exactly the bytes of the file.
+        /// @throws FileOperationException if the file was loaded without its
+        ///         sections.
+        void Save(std::vector<char>& buffer) const;
+
+        /// @brief Saves the whole SPC file into a buffer in memory.
+        /// @param buffer The buffer to write to.
+        /// @param size The size of the buffer, in bytes.
+        /// @return The number of bytes written, which is SerializedSize().
+        /// @throws std::out_of_range if the buffer is too small for the file.
+        /// @throws FileOperationException if the file was loaded without its
+        ///         sections.
+        size_t Save(char* buffer, size_t size) const;
+
+        /// @brief Saves only the ID666 tag and extended data to disk.
+        ///
+        /// Rather than rewriting the whole file, this patches the existing file
+        /// in place: the tag region at Id666::tagOffset is overwritten and the
+        /// extended data chunk at Id666::Extended::dataOffset is rewritten, 
+        /// with the file truncated or extended to fit the new chunk. The 
+        /// header, RAM and DSP registers on disk are left untouched.
+        ///
+        /// @pre The file path points to a valid SPC file that exists.
+        /// @post The tag and extended data on disk match the class data.
+        /// @throws FileOperationException if the file cannot open or write.
+        /// @throws FileCorruptException if the file is too small to patch.
+        void SaveTag();
+
         /// @brief Creates a copy of the file with a new name based on metadata.
         ///
         /// Uses the specified pattern to determine what the copy file should be
-        /// named based on the tag metadata. The pattern consists of 
+        /// named based on the tag metadata. The mode selects whether the 
+        /// new file is a copy, a clone, a hard link, or the file itself 
+        /// renamed. The pattern consists of 
         /// literal characters and placeholders that bring in values from the
         /// tag. For example, if the tag has a track number of 02 and a song
         /// title of "Intro", you would use the following pattern to get the
@@ -153,19 +432,76 @@ namespace Spc
         ///
         /// %track% - %song%.spc
         ///
-        /// Supported placeholders currently include:
+        /// Every field of the tag has a placeholder:
         ///
         /// %song% - The song title.
         /// %game% - The game title.
-        /// %artist% - The name of the person who dumped the SPC file.
+        /// %dumper% - The name of the person who dumped the SPC file.
+        /// %comments% - The comments.
+        /// %date% - The date the SPC file was dumped, as MM-DD-YYYY.
+        /// %length% - The song length, in seconds.
+        /// %fade% - The fade length, in milliseconds.
+        /// %artist% - The song artist.
+        /// %channels% - The default disabled channels.
+        /// %emulator% - The emulator used to dump the SPC file.
+        /// %ost% - The OST title.
         /// %disc% - The OST disc number.
         /// %track% - The OST track number.
+        /// %publisher% - The publisher name.
+        /// %year% - The copyright year.
+        /// %intro% - The intro length, in ticks.
+        /// %loop% - The loop length, in ticks.
+        /// %end% - The end length, in ticks.
+        /// %fadeticks% - The extended fade length, in ticks.
+        /// %muted% - The muted voices.
+        /// %loops% - The number of times to loop.
+        /// %preamp% - The preamp level.
+        ///
+        /// A placeholder may be followed by a format that pads its value to
+        /// a minimum width, such as %track:02% for "02" or %song:-20% for a
+        /// song title padded on the right with spaces. See 
+        /// Id666::Pattern::FormatSpec for the syntax.
         ///
         /// @param pattern The pattern to select the metadata.
+        /// @param mode How the file with the new name is created.
         /// @return True if the file was successfully copied, false otherwise.
         /// @pre Must be a valid pattern with supported placeholders.
         /// @post The file on disk is copied to match the pattern if valid.
-        bool TagToFileName(const std::string& pattern);
+        /// @post If the mode is TransferMode::Move, Path() is the new path
+        ///       and the file is saved to and loaded from the new path.
+        ///       Move fails for a file given its own Binary::FileStream,
+        ///       since that stream cannot follow the file to the new path.
+        bool TagToFileName(const std::string& pattern, 
+                           TransferMode mode = TransferMode::Copy);
+
+        /// @brief Copies the file to a file name based on the tag.
+        ///
+        /// Behaves like the overload that takes a pattern string, but uses a
+        /// pattern that has already been compiled, so renaming many files
+        /// with the same pattern only lexes and parses it once.
+        ///
+        /// @param pattern The compiled pattern to select the metadata.
+        /// @param mode How the file with the new name is created.
+        /// @return True if the file was successfully copied, false otherwise.
+        /// @post The file on disk is copied to match the pattern if valid.
+        bool TagToFileName(const Id666::Pattern::Compiled& pattern,
+                           TransferMode mode = TransferMode::Copy);
+
+        /// @brief Copies the file into a directory tree based on the tag.
+        ///
+        /// Unlike the other overloads, the copy is placed under the layout's
+        /// root rather than next to the file, and a '/' in the pattern 
+        /// creates a directory, so "%game%/%track% - %song%.spc" copies the
+        /// file into a directory named after its game. The layout creates 
+        /// each directory only once, so reuse one layout for every file that
+        /// is being reorganized.
+        ///
+        /// @param layout The layout that names the copy.
+        /// @param mode How the file with the new name is created.
+        /// @return True if the file was successfully copied, false otherwise.
+        /// @post The file on disk is copied into the layout if valid.
+        bool TagToFileName(Layout& layout, 
+                           TransferMode mode = TransferMode::Copy);
 
         /// @brief Updates the tag based on the file name.
         ///
@@ -176,106 +512,204 @@ namespace Spc
         /// pattern "%track% - %song%.spc" to extract the track number and 
         /// song title from the file name and set them in the tag.
         ///
-        /// Supported placeholders currently include:
-        ///
-        /// %song% - The song title.
-        /// %game% - The game title.
-        /// %artist% - The name of the person who dumped the SPC file.
-        /// %disc% - The OST disc number.
-        /// %track% - The OST track number.
+        /// It supports the same placeholders and formats as TagToFileName().
+        /// Space padding from a format is left out of the values that are
+        /// set.
         ///
         /// @param pattern The pattern to select the metadata.
         /// @return True if the tag was successfully updated, false otherwise.
         /// @pre Must be a valid pattern with supported placeholders.
         /// @post The tag is updated based on the file name if pattern is valid.
         bool FileNameToTag(const std::string& pattern);
+
+        /// @brief Updates the tag based on the file name.
+        ///
+        /// Behaves like the overload that takes a pattern string, but uses a
+        /// pattern that has already been compiled.
+        ///
+        /// @param pattern The compiled pattern to select the metadata.
+        /// @return True if the tag was successfully updated, false otherwise.
+        /// @post The tag is updated based on the file name if pattern is valid.
+        bool FileNameToTag(const Id666::Pattern::Compiled& pattern);
     private:
+        // The position of each section in loadedSections.
+        enum SectionIndex
+        {
+            ramIndex,
+            dspRegistersIndex,
+            unusedIndex,
+            extraRamIndex,
+            sectionCount
+        };
+
         std::string path;
         Spc::Header header;
         Spc::Id666::Tag tag;
-        Binary::BufferStream ram;
-        Binary::BufferStream dspRegisters;
-        Binary::BufferStream unused;
-        Binary::BufferStream extraRam;
+
+        // The sections are mutable because a mapped file copies them out of
+        // the mapping on first access, even through const accessors. This
+        // does not change their observable contents, and sectionsCopy makes
+        // sure the copy happens once even when several threads race to it.
+        mutable Binary::BufferStream ram;
+        mutable Binary::BufferStream dspRegisters;
+        mutable Binary::BufferStream unused;
+        mutable Binary::BufferStream extraRam;
         std::shared_ptr<Binary::FileStream> fileStream;
 
+        // True if the file created its own stream for the path, rather than
+        // being given one, so it can make a new one when the path changes.
+        bool ownsStream{ false };
+        std::shared_ptr<MappedFile> mapping;
+        mutable OnceFlag sectionsCopy;
+        // The sections that hold the file's bytes, indexed by SectionIndex,
+        // which starts out with every bit set. A file loaded with 
+        // LoadMode::Metadata has none of them until they are set.
+        std::bitset<sectionCount> loadedSections{ ~0ul };
+        bool isSynced{ false };
+        bool headerChanged{ false };
+        std::bitset<ramPageCount> changedRamPages;
+        bool dspRegistersChanged{ false };
+        bool unusedChanged{ false };
+        bool extraRamChanged{ false };
+        Binary::BufferStream savedTag{ Id666::tagSize };
+        std::vector<char> savedExtendedData;
+
+        /// @brief Records which RAM pages replacing the RAM dump would change.
+        /// @param r The RAM dump that will replace the current one.
+        void MarkChangedRamPages(const Binary::BufferStream& r);
+
+        /// @brief Determines if replacing a section would change its bytes.
+        /// @param current The section as it currently is.
+        /// @param replacement The section that will replace it.
+        /// @param index The section's position in loadedSections.
+        /// @return True if the section would change, otherwise false.
+        bool SectionChanges(const Binary::BufferStream& current,
+                            const Binary::BufferStream& replacement,
+                            SectionIndex index) const;
+
+        /// @brief Serializes the extended data chunk, including its header.
+        /// @return The bytes of the chunk, or none if there is no extended data.
+        std::vector<char> SerializeExtendedData() const;
+
+        /// @brief Writes a serialized extended data chunk to the stream.
+        /// @param bytes The bytes of the chunk, or none to write nothing.
+        /// @pre The stream is open and positioned where the chunk belongs.
+        void WriteExtendedData(const std::vector<char>& bytes);
+
+        /// @brief Records the tag and extended data as they are on disk.
+        /// @post Unchanged tag data is no longer written by Save().
+        void SnapshotTag();
+
+        /// @brief Records every section as it is on disk.
+        /// @post Save() writes nothing until the file is modified.
+        void MarkSynced();
+
+        /// @brief Writes the whole file to disk.
+        /// @throws FileOperationException if the file cannot open or write.
+        void SaveAll();
 
-        /// @brief Loads a string type item from the extended tag data.
-        /// @param item The extended tag item to load into.
-        /// @param sizeRemaining The number of bytes remaining to be read.
-        /// @post The item is populated with the string data
-        /// @post sizeRemaining is updated.
-        /// @throws FileCorruptException if the file appears corrupt.
-        void LoadStringItem(std::shared_ptr<Id666::Extended::Item> item,
-                            size_t& sizeRemaining);
+        /// @brief Writes only the changed byte ranges to disk.
+        /// @throws FileOperationException if the file cannot open or write.
+        /// @throws FileCorruptException if the file is too small to patch.
+        void SaveChanges();
 
+        /// @brief Writes the runs of changed RAM pages at their offsets.
+        /// @pre The file stream is open for writing.
+        void WriteChangedRamPages();
 
-        /// @brief Loads padding bytes from the extended tag data.
-        /// @param item The extended tag item to load padding into.
-        /// @param sizeRemaining The number of bytes remaining to be read.
-        /// @post The item is updated to reflect the padding
-        /// @post sizeRemaining is updated.
-        /// @throws FileCorruptException if the file appears corrupt.
-        void LoadPadding(std::shared_ptr<Id666::Extended::Item> item,
-                         size_t& sizeRemaining);
+        /// @brief Zeroes the bytes past the specified size through an injected
+        ///        stream, which cannot be truncated.
+        /// @param originalSize The size of the file before it was written.
+        /// @param newSize The size the file should be.
+        /// @pre The file stream is open for writing.
+        void ClearTail(size_t originalSize, size_t newSize);
 
+        /// @brief Truncates the file if it is larger than the specified size.
+        ///
+        /// Only files whose stream was created from Path() are truncated; see
+        /// ClearTail() for injected streams.
+        ///
+        /// @param originalSize The size of the file before it was written.
+        /// @param newSize The size the file should be.
+        /// @throws FileOperationException if the file cannot be resized.
+        void TruncateFile(size_t originalSize, size_t newSize);
+
+        /// @brief Gets a section, copying the sections out of any mapping.
+        /// @param buffer The buffer that holds the section.
+        /// @return The buffer, which holds the section's bytes.
+        /// @param index The section's position in loadedSections.
+        /// @throws FileOperationException if the section was not loaded.
+        const Binary::BufferStream& Section(
+            const Binary::BufferStream& buffer,
+            SectionIndex index) const;
+
+        /// @brief Gets a view of a section, pointing into the mapping if any.
+        /// @param buffer The buffer that holds the section when not mapped.
+        /// @param info The offset and size of the section within the file.
+        /// @param index The section's position in loadedSections.
+        /// @return A Spc::ByteView of the section.
+        /// @throws FileOperationException if the section was not loaded.
+        ByteView SectionView(const Binary::BufferStream& buffer,
+                             FieldInfo info,
+                             SectionIndex index) const;
+
+        /// @brief Copies mapped sections into their buffers, then unmaps.
+        /// @post The file no longer refers to the mapping.
+        void Unmap();
+
+        /// @brief Loads the file by reading each section through the stream.
+        /// @throws FileOperationException if the file cannot be opened or read.
+        /// @throws FileCorruptException if the file is not a valid SPC file.
+        void LoadStream();
 
-        /// @brief Loads a length type item from the extended tag data.
-        /// @param item The extended tag item to load into.
-        /// @post The item is populated with the length type data.
-        /// @post sizeRemaining is updated.
-        /// @throws FileCorruptException if the file appears corrupt.
-        void LoadLengthItem(std::shared_ptr<Id666::Extended::Item> item);
+        /// @brief Loads the file by mapping it into memory.
+        /// @throws FileOperationException if the file cannot be mapped.
+        /// @throws FileCorruptException if the file is not a valid SPC file.
+        void LoadMapped();
 
+        /// @brief Loads only the header, tag and extended data from the stream.
+        /// @throws FileOperationException if the file cannot be opened or read.
+        /// @throws FileCorruptException if the file is not a valid SPC file.
+        void LoadMetadata();
 
-        /// @brief Loads an integer type item from the extended tag data.
-        /// @param item The extended tag item to load into.
-        /// @param sizeRemaining The number of bytes remaining.
-        /// @post The item is populated with the integer type data.
-        /// @post sizeRemaining is updated.
+        /// @brief Loads the file with a single read into one buffer.
+        /// @throws FileOperationException if the file cannot be opened or read.
+        /// @throws FileCorruptException if the file is not a valid SPC file.
+        void LoadBuffered();
+
+        /// @brief Loads the extended tag data from the stream, if present.
+        /// @param stream The stream positioned before the extended chunk.
+        /// @post The tag's extended data holds the chunk's items, or none if
+        ///       there is no chunk.
         /// @throws FileCorruptException if the file appears corrupt.
-        void LoadIntegerItem(std::shared_ptr<Id666::Extended::Item> item,
-                             size_t& sizeRemaining);
-
-
-        /// @brief Matches a numeric pattern node against the string stream.
-        /// @param stream The string stream to match against.
-        /// @param fileName The full file name being matched.
-        /// @param node The current pattern node to match.
-        /// @param nextNode Pointer to the next pattern node.
-        /// @param numericString The parsed numeric string value.
-        /// @return True if the numeric pattern matches, false otherwise.
-        bool MatchNumeric(std::stringstream& stream, 
-                  const std::string& fileName,
-                  Id666::Pattern::Node node,
-                  Id666::Pattern::Node* nextNode,
-                  std::string& numericString);
-
-
-        /// @brief Matches a text pattern node against the string stream.
-        /// @param stream The string stream to match against.
-        /// @param fileName The full file name being matched.
-        /// @param node The current pattern node to match.
-        /// @param nextNode Pointer to the next pattern node.
-        /// @param textString The parsed text string value.
-        /// @return True if the text pattern matches, false otherwise.
-        bool MatchText(std::stringstream& stream,
-                   const std::string& fileName,
-                   Id666::Pattern::Node node,
-                   Id666::Pattern::Node* nextNode,
-                   std::string& textString);
-    };
+        void LoadExtendedData(const Binary::Stream& stream);
 
-    /// @brief Matches a literal pattern node against the string stream.
-    /// @param stream The string stream to match against.
-    /// @param node The pattern node representing the literal to match.
-    /// @return True if the literal matches the stream, false otherwise.
-    bool MatchLiteral(std::stringstream& stream, Id666::Pattern::Node node);
+        /// @brief Parses the header, tag and extended data from the bytes.
+        /// @param bytes The bytes of the whole file.
+        /// @pre The bytes are at least as large as the sections.
+        /// @throws FileCorruptException if the file appears corrupt.
+        void ParseMetadata(ByteView bytes);
 
-    /// @brief Checks if the end of the string stream has been reached.
-    /// @param stream The string stream to check.
-    /// @return True if the stream is at the end, false otherwise.
-    bool MatchEnd(std::stringstream& stream);
+        /// @brief Parses the extended tag data from the cursor, if present.
+        /// @param cursor The cursor positioned before the extended chunk.
+        /// @post The tag's extended data holds the chunk's items, or none if
+        ///       there is no chunk.
+        /// @throws FileCorruptException if the file appears corrupt.
+        void ParseExtendedData(ByteCursor& cursor);
+
+        /// @brief Copies the RAM, DSP registers, unused area and extra RAM.
+        /// @param bytes The bytes of the whole file.
+        /// @pre The bytes are at least as large as the sections.
+        void CopySections(ByteView bytes) const;
+
+        /// @brief Creates the file at a new path using the specified mode.
+        /// @param destinationPath The path of the new file.
+        /// @param mode How the new file is created.
+        /// @return True if the new file was created, false otherwise.
+        /// @post If the mode is TransferMode::Move, the path is updated.
+        bool TransferTo(const std::filesystem::path& destinationPath, 
+                        TransferMode mode);
+    };
 
     /// @brief Parses a pattern string into a sequence of pattern nodes.
     /// @param pattern The pattern string to parse.
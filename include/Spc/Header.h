@@ -17,6 +17,7 @@
 #ifndef SPC_HEADER_H
 #define SPC_HEADER_H
 
+#include <tuple>
 #include <vector>
 #include "DataStructure.h"
 #include "TextField.h"
@@ -75,6 +76,20 @@ namespace Spc
         /// The constructor initializes this internal vector.
         Header();
 
+        /// @brief Copy constructor; copies the fields of another header.
+        ///
+        /// The internal vector returned by SpcFields() points to this header's
+        /// own fields rather than to the fields of the header it was copied 
+        /// from.
+        ///
+        /// @param other The header to copy.
+        Header(const Header& other);
+
+        /// @brief Copy assignment operator; copies the fields of a header.
+        /// @param other The header to copy.
+        /// @return A reference to this header.
+        Header& operator=(const Header& other);
+
         /// @brief Determines if the header indicates tag is present.
         /// @return True if header indicates tag is present, otherwise false.
         bool ContainsTag() const;
@@ -83,6 +98,27 @@ namespace Spc
         std::vector<Field*> SpcFields() const override { return spcFields; }
     private:
         std::vector<Field*> spcFields;
+
+        /// @brief Gets pointers to every field member, in file order.
+        ///
+        /// Constructing, copying and listing the fields all walk this tuple,
+        /// so adding a field to the header only requires adding it here.
+        ///
+        /// @return The tuple of pointers to the field members.
+        static constexpr auto Members()
+        {
+            return std::make_tuple(&Header::id,
+                                   &Header::separator,
+                                   &Header::containsTag,
+                                   &Header::versionMinor,
+                                   &Header::pcRegister,
+                                   &Header::aRegister,
+                                   &Header::xRegister,
+                                   &Header::yRegister,
+                                   &Header::pswRegister,
+                                   &Header::spRegister,
+                                   &Header::reserved);
+        }
     };
 }
 
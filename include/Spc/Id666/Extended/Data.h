@@ -17,6 +17,7 @@
 #ifndef SPC_ID666_EXTENDED_DATA_H
 #define SPC_ID666_EXTENDED_DATA_H
 
+#include <array>
 #include <memory>
 #include <vector>
 #include "Spc/DataStructure.h"
@@ -33,6 +34,9 @@ namespace Spc::Id666::Extended
     /// @brief Defines the IFF chunk ID for the ID666 extended tag data.
     extern const char* chunkId;
 
+    /// @brief The size of the IFF chunk header, which is the ID and data size.
+    inline constexpr size_t chunkHeaderSize{ 8 };
+
     /// @brief Represents the extended ID666 tag data.
     ///
     /// The extended ID666 tag items are typically used when a value, such as 
@@ -162,6 +166,28 @@ namespace Spc::Id666::Extended
 
         /// @copydoc Spc::DataStructure::Fields()
         std::vector<Field*> SpcFields() const override;
+
+        /// @brief Gets the size of all items in the extended data.
+        ///
+        /// The size is summed from the items directly rather than from the
+        /// list of fields returned by SpcFields().
+        ///
+        /// @return The size of the items in bytes.
+        size_t Size() const override;
+
+        /// @brief Gets pointers to every item member, in ascending ID order.
+        /// @return The array of pointers to the item members.
+        static constexpr std::array<std::shared_ptr<Item> Data::*, 19> Items()
+        {
+            return { &Data::songTitle, &Data::gameTitle, &Data::songArtist,
+                     &Data::dumperName, &Data::dateDumped, &Data::emulatorUsed,
+                     &Data::comments, &Data::ostTitle, &Data::ostDisc, 
+                     &Data::ostTrack, &Data::publisherName, 
+                     &Data::copyrightYear, &Data::introLength, 
+                     &Data::loopLength, &Data::endLength, &Data::fadeLength,
+                     &Data::mutedVoices, &Data::loopTimes, 
+                     &Data::preampLevel };
+        }
     };
 }
 
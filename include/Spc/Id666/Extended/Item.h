@@ -64,6 +64,10 @@ namespace Spc::Id666::Extended
 
         /// @copydoc Spc::DataStructure::Fields()
         std::vector<Field*> SpcFields() const override;
+
+        /// @brief Gets the size of the item, including its header.
+        /// @return The size of the fields returned by SpcFields(), in bytes.
+        size_t Size() const override;
     };
 }
 
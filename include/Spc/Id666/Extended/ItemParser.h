@@ -0,0 +1,63 @@
+// ItemParser.h - Declares the Spc::Id666::Extended::ItemParser class.
+//
+// Copyright (C) 2026 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef SPC_ID666_EXTENDED_ITEM_PARSER_H
+#define SPC_ID666_EXTENDED_ITEM_PARSER_H
+
+#include <cstddef>
+#include <optional>
+#include "Spc/ByteCursor.h"
+#include "ItemTable.h"
+
+namespace Spc::Id666::Extended
+{
+    /// @brief Parses the items of an extended (xid6) chunk.
+    ///
+    /// Items are parsed in place with a single bounds-checked cursor, so each
+    /// item is returned as a view of the chunk's bytes rather than a copy.
+    /// Every item is validated against its type and the field that uses its
+    /// ID before it is returned.
+    class ItemParser
+    {
+    public:
+        /// @brief Constructor; creates a parser for the items of a chunk.
+        ///
+        /// The chunk size normally matches the size of the bytes, but a 
+        /// corrupt chunk may claim to be larger than the data that follows
+        /// its header. Items are parsed until the chunk size is used up, and
+        /// an item that runs past the bytes is reported as corrupt.
+        ///
+        /// @param bytes The bytes that follow the chunk header.
+        /// @param chunkSize The size of the chunk's data from its header.
+        ItemParser(ByteView bytes, size_t chunkSize) 
+            : cursor{ bytes }, sizeRemaining{ chunkSize } { }
+
+        /// @brief Parses the next item of the chunk.
+        /// @return The view of the item, or std::nullopt after the last item.
+        /// @throws FileCorruptException if the item is invalid or truncated.
+        std::optional<ItemView> Next();
+
+        /// @brief Parses every remaining item of the chunk into a table.
+        /// @return The table holding the items.
+        /// @throws FileCorruptException if an item is invalid or truncated.
+        ItemTable ParseAll();
+    private:
+        ByteCursor cursor;
+        size_t sizeRemaining;
+    };
+}
+
+#endif
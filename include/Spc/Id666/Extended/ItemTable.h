@@ -0,0 +1,234 @@
+// ItemTable.h - Declares the Spc::Id666::Extended::ItemTable class.
+//
+// Copyright (C) 2026 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef SPC_ID666_EXTENDED_ITEM_TABLE_H
+#define SPC_ID666_EXTENDED_ITEM_TABLE_H
+
+#include <array>
+#include <cstdint>
+#include <optional>
+#include <vector>
+#include "Spc/ByteView.h"
+#include "Data.h"
+
+namespace Spc::Id666::Extended
+{
+    /// @brief A read-only view of an extended item stored elsewhere.
+    ///
+    /// The view does not own the payload or padding bytes, so the storage
+    /// they refer to must outlive the view.
+    struct ItemView
+    {
+        /// @brief The ID of the item.
+        uint8_t id{ 0 };
+
+        /// @brief The type of the item.
+        uint8_t type{ 0 };
+
+        /// @brief The value of a length item, otherwise the payload's size.
+        uint16_t data{ 0 };
+
+        /// @brief The bytes that follow the item header, if any.
+        ByteView payload;
+
+        /// @brief The bytes that pad a string payload to a 4-byte boundary.
+        ByteView padding;
+
+        /// @brief Gets the size of the item, including its header.
+        /// @return The size of the item in bytes.
+        size_t Size() const
+        {
+            return itemHeaderSize + payload.Size() + padding.Size();
+        }
+    };
+
+    /// @brief Creates a view of a decoded item.
+    /// @param item The item to view, which must outlive the view.
+    /// @return The view of the item.
+    ItemView ViewOf(const Item& item);
+
+    /// @brief Stores extended items in a single contiguous buffer.
+    ///
+    /// Items are kept in their xid6 layout (header, payload and padding) one
+    /// after the other, and a fixed table indexed by item ID holds the offset
+    /// of each one. Storing a whole chunk therefore costs a single allocation,
+    /// and items are visited in ascending ID order, which is the order they
+    /// are written to an SPC file.
+    class ItemTable
+    {
+    public:
+        /// @brief Visits the items of a table in ascending ID order.
+        class Iterator
+        {
+        public:
+            /// @brief Constructor; creates an iterator at the specified ID.
+            /// @param t The table to iterate.
+            /// @param i The first ID to consider.
+            Iterator(const ItemTable& t, size_t i) : table{ &t }, id{ i }
+            {
+                SkipAbsent();
+            }
+
+            /// @brief Gets a view of the current item.
+            /// @return The view of the item.
+            ItemView operator*() const { return table->ViewAt(id); }
+
+            /// @brief Moves to the item with the next highest ID.
+            /// @return A reference to this iterator.
+            Iterator& operator++()
+            {
+                id++;
+                SkipAbsent();
+                return *this;
+            }
+
+            /// @brief Determines if two iterators are at the same item.
+            /// @param other The iterator to compare with.
+            /// @return True if the iterators are at the same item.
+            bool operator==(const Iterator& other) const
+            {
+                return id == other.id;
+            }
+
+            /// @brief Determines if two iterators are at different items.
+            /// @param other The iterator to compare with.
+            /// @return True if the iterators are at different items.
+            bool operator!=(const Iterator& other) const
+            {
+                return id != other.id;
+            }
+        private:
+            const ItemTable* table;
+            size_t id;
+
+            void SkipAbsent()
+            {
+                while (id < maxItems && table->offsets[id] == 0)
+                {
+                    id++;
+                }
+            }
+        };
+
+        /// @brief The number of distinct item IDs.
+        static constexpr size_t maxItems{ 256 };
+
+        /// @brief Constructor; creates an empty table.
+        ItemTable() : offsets{}, count{ 0 } { }
+
+        /// @brief Creates a table holding the items of the extended data.
+        /// @param data The extended data to copy the items from.
+        /// @return The table holding a copy of every item.
+        static ItemTable FromData(const Data& data);
+
+        /// @brief Determines if the table holds no items.
+        /// @return True if the table is empty, otherwise false.
+        bool Empty() const { return count == 0; }
+
+        /// @brief Gets the number of items in the table.
+        /// @return The number of items.
+        size_t Count() const { return count; }
+
+        /// @brief Gets the size of all items in the table.
+        ///
+        /// This is the size of the data of an xid6 chunk holding the items.
+        ///
+        /// @return The size of the items in bytes.
+        size_t Size() const { return bytes.size(); }
+
+        /// @brief Gets the size of an xid6 chunk holding the items.
+        /// @return The size including the chunk header, or 0 if empty.
+        size_t ChunkSize() const
+        {
+            return Empty() ? 0 : chunkHeaderSize + bytes.size();
+        }
+
+        /// @brief Writes an xid6 chunk holding the items to a buffer.
+        ///
+        /// The chunk header is followed by the items in ascending ID order,
+        /// which is the order they have always been saved in.
+        ///
+        /// @param destination The buffer to write the chunk to.
+        /// @pre The buffer holds at least ChunkSize() bytes.
+        void WriteChunk(char* destination) const;
+
+        /// @brief Determines if the table holds an item with the ID.
+        /// @param id The ID of the item.
+        /// @return True if the item exists, otherwise false.
+        bool Contains(uint8_t id) const { return offsets[id] != 0; }
+
+        /// @brief Finds the item with the specified ID.
+        /// @param id The ID of the item.
+        /// @return A view of the item, or no value if it does not exist.
+        std::optional<ItemView> Find(uint8_t id) const;
+
+        /// @brief Stores a copy of an item, replacing any item with its ID.
+        ///
+        /// An item replacing one of the same size is stored in place.
+        /// Otherwise the old item is removed and the new item is appended.
+        /// String payloads without padding get zero padding.
+        ///
+        /// @param item The item to store.
+        void Set(const ItemView& item);
+
+        /// @brief Removes the item with the specified ID, if it exists.
+        /// @param id The ID of the item.
+        void Remove(uint8_t id);
+
+        /// @brief Removes every item from the table.
+        void Clear();
+
+        /// @brief Reserves storage so items up to a total size fit.
+        /// @param size The total size of the items in bytes.
+        void Reserve(size_t size) { bytes.reserve(size); }
+
+        /// @brief Stores every item of the table in the extended data.
+        ///
+        /// Each item is decoded into a new Item and assigned to the member
+        /// that Id666::FindExtendedField() gives for its ID. Items with an ID
+        /// that no field uses are skipped.
+        ///
+        /// @param data The extended data to store the items in.
+        void DecodeInto(Data& data) const;
+
+        /// @brief Stores the item with the specified ID in the extended data.
+        ///
+        /// Nothing is stored if the table has no such item, or if no field
+        /// uses its ID.
+        ///
+        /// @param data The extended data to store the item in.
+        /// @param id The ID of the item.
+        void DecodeInto(Data& data, uint8_t id) const;
+
+        /// @brief Gets an iterator to the item with the lowest ID.
+        /// @return The iterator.
+        Iterator begin() const { return Iterator{ *this, 0 }; }
+
+        /// @brief Gets an iterator past the item with the highest ID.
+        /// @return The iterator.
+        Iterator end() const { return Iterator{ *this, maxItems }; }
+    private:
+        std::vector<char> bytes;
+
+        // The offset of each item plus one, indexed by ID; zero if absent.
+        std::array<uint32_t, maxItems> offsets;
+        size_t count;
+
+        ItemView ViewAt(size_t id) const;
+    };
+}
+
+#endif
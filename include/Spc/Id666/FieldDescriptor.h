@@ -0,0 +1,346 @@
+// FieldDescriptor.h - Declares the Spc::Id666::FieldDescriptor struct.
+//
+// Copyright (C) 2026 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef SPC_ID666_FIELD_DESCRIPTOR_H
+#define SPC_ID666_FIELD_DESCRIPTOR_H
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include "Spc/Id666/TagFieldInfo.h"
+#include "Spc/Id666/Extended/ItemInfo.h"
+#include "Spc/Id666/Extended/Data.h"
+
+namespace Spc::Id666
+{
+    /// @brief The minimum value for numeric fields in the tag.
+    inline constexpr size_t minNumeric{ 0 };
+
+    /// @brief The minimum value for preamp level field in the tag.
+    inline constexpr size_t minPreampLevel{ 32768 };
+
+    /// @brief The maximum length of a song, in seconds, allowed.
+    inline constexpr size_t maxSongLength{ 959 };
+
+    /// @brief The maximum length of a fade, in milliseconds, allowed.
+    inline constexpr size_t maxFadeLength{ 59999 };
+
+    /// @brief The maximum disc number allowed.
+    inline constexpr size_t maxDiscNumber{ 9 };
+
+    /// @brief The maximum track number allowed.
+    inline constexpr size_t maxTrackNumber{ 99 };
+
+    /// @brief The maximum number of song loops allowed.
+    inline constexpr size_t maxLoopTimes{ 9 };
+
+    /// @brief The maximum preamp level allowed.
+    inline constexpr size_t maxPreampLevel{ 524288 };
+
+    /// @brief The maximum number of ticks used for extended tag timings.
+    inline constexpr size_t maxTicks{ 383999999 };
+
+    /// @brief The maximum copyright year allowed.
+    inline constexpr size_t maxCopyrightYear{ 65535 };
+
+    /// @brief Determines which Spc::Field type represents a tag field.
+    enum class FieldKind
+    {
+        /// @brief The field is represented by a Spc::TextField.
+        Text,
+
+        /// @brief The field is represented by a Spc::DateField.
+        Date,
+
+        /// @brief The field is represented by a Spc::NumericField.
+        Numeric,
+
+        /// @brief The field is represented by a Spc::BinaryField.
+        Binary,
+
+        /// @brief The field is represented by a Spc::EmulatorField.
+        Emulator,
+
+        /// @brief The field is represented by a Spc::TrackField.
+        Track
+    };
+
+    /// @brief Describes a field of the ID666 tag in a single place.
+    ///
+    /// A descriptor ties together the label of a field, where it lives in the
+    /// non-extended tag, which extended item can hold it, and the range of
+    /// values it accepts. Every descriptor is constexpr, so generic code can
+    /// walk fieldDescriptors at compile time as well as at run time.
+    struct FieldDescriptor
+    {
+        /// @brief The label given to fields read from the tag.
+        const char* label;
+
+        /// @brief The label given to fields read from an extended item.
+        ///
+        /// This is the label followed by a '*', kept as its own literal so
+        /// reading an extended field does not build it each time.
+        const char* extendedLabel;
+
+        /// @brief The type of field that represents the value.
+        FieldKind kind;
+
+        /// @brief The offsets and sizes in the non-extended tag.
+        ///
+        /// This is null for fields that only exist in the extended tag.
+        const TagFieldInfo* info;
+
+        /// @brief The id and type of the extended item for the field.
+        ///
+        /// This is null for fields that have no extended item.
+        const Extended::ItemInfo* item;
+
+        /// @brief The member of Extended::Data that holds the extended item.
+        ///
+        /// This is null for fields that have no extended item.
+        std::shared_ptr<Extended::Item> Extended::Data::* member;
+
+        /// @brief The minimum value accepted by a numeric field.
+        int64_t min;
+
+        /// @brief The maximum value accepted by a numeric field.
+        int64_t max;
+
+        /// @brief Determines if the field exists in the non-extended tag.
+        /// @return True if the field has a non-extended location.
+        constexpr bool InTag() const { return info != nullptr; }
+
+        /// @brief Determines if the field can be held by an extended item.
+        /// @return True if the field has an extended item.
+        constexpr bool IsExtended() const { return item != nullptr; }
+
+        /// @brief Determines if the field's values are limited to a range.
+        /// @return True if min and max describe the accepted values.
+        constexpr bool HasRange() const { return min < max; }
+    };
+
+    /// @brief Describes the song title field.
+    inline constexpr FieldDescriptor songTitleField
+    {
+        "Song Title", "Song Title*",
+        FieldKind::Text, &songTitleInfo,
+        &Extended::songTitleInfo, &Extended::Data::songTitle, 0, 0
+    };
+
+    /// @brief Describes the game title field.
+    inline constexpr FieldDescriptor gameTitleField
+    {
+        "Game Title", "Game Title*",
+        FieldKind::Text, &gameTitleInfo,
+        &Extended::gameTitleInfo, &Extended::Data::gameTitle, 0, 0
+    };
+
+    /// @brief Describes the dumper name field.
+    inline constexpr FieldDescriptor dumperNameField
+    {
+        "Dumper Name", "Dumper Name*",
+        FieldKind::Text, &dumperNameInfo,
+        &Extended::dumperNameInfo, &Extended::Data::dumperName, 0, 0
+    };
+
+    /// @brief Describes the comments field.
+    inline constexpr FieldDescriptor commentsField
+    {
+        "Comments", "Comments*",
+        FieldKind::Text, &commentsInfo,
+        &Extended::commentsInfo, &Extended::Data::comments, 0, 0
+    };
+
+    /// @brief Describes the date dumped field.
+    inline constexpr FieldDescriptor dateDumpedField
+    {
+        "Date Dumped", "Date Dumped*",
+        FieldKind::Date, &dateDumpedInfo,
+        &Extended::dateDumpedInfo, &Extended::Data::dateDumped, 0, 0
+    };
+
+    /// @brief Describes the song length field.
+    inline constexpr FieldDescriptor songLengthField
+    {
+        "Song Length (seconds)", "Song Length (seconds)*",
+        FieldKind::Numeric, &songLengthInfo,
+        nullptr, nullptr, minNumeric, maxSongLength
+    };
+
+    /// @brief Describes the fade length field.
+    inline constexpr FieldDescriptor fadeLengthField
+    {
+        "Fade Length (ms)", "Fade Length (ms)*",
+        FieldKind::Numeric, &fadeLengthInfo,
+        nullptr, nullptr, minNumeric, maxFadeLength
+    };
+
+    /// @brief Describes the song artist field.
+    inline constexpr FieldDescriptor songArtistField
+    {
+        "Song Artist", "Song Artist*",
+        FieldKind::Text, &songArtistInfo,
+        &Extended::songArtistInfo, &Extended::Data::songArtist, 0, 0
+    };
+
+    /// @brief Describes the default disabled channels field.
+    inline constexpr FieldDescriptor defaultDisabledChannelsField
+    {
+        "Default Disabled Channels", "Default Disabled Channels*",
+        FieldKind::Binary,
+        &defaultDisabledChannelsInfo, nullptr, nullptr, 0, 0
+    };
+
+    /// @brief Describes the emulator used field.
+    inline constexpr FieldDescriptor emulatorUsedField
+    {
+        "Emulator Used", "Emulator Used*",
+        FieldKind::Emulator, &emulatorUsedInfo,
+        &Extended::emulatorUsedInfo, &Extended::Data::emulatorUsed, 0, 0
+    };
+
+    /// @brief Describes the OST title field.
+    inline constexpr FieldDescriptor ostTitleField
+    {
+        "OST Title", "OST Title*",
+        FieldKind::Text, nullptr,
+        &Extended::ostTitleInfo, &Extended::Data::ostTitle, 0, 0
+    };
+
+    /// @brief Describes the OST disc field.
+    inline constexpr FieldDescriptor ostDiscField
+    {
+        "OST Disc", "OST Disc*",
+        FieldKind::Numeric, nullptr, &Extended::ostDiscInfo,
+        &Extended::Data::ostDisc, minNumeric, maxDiscNumber
+    };
+
+    /// @brief Describes the OST track field.
+    inline constexpr FieldDescriptor ostTrackField
+    {
+        "OST Track", "OST Track*",
+        FieldKind::Track, nullptr, &Extended::ostTrackInfo,
+        &Extended::Data::ostTrack, minNumeric, maxTrackNumber
+    };
+
+    /// @brief Describes the publisher name field.
+    inline constexpr FieldDescriptor publisherNameField
+    {
+        "Publisher Name", "Publisher Name*",
+        FieldKind::Text, nullptr,
+        &Extended::publisherNameInfo, &Extended::Data::publisherName, 0, 0
+    };
+
+    /// @brief Describes the copyright year field.
+    inline constexpr FieldDescriptor copyrightYearField
+    {
+        "Copyright Year", "Copyright Year*",
+        FieldKind::Numeric, nullptr,
+        &Extended::copyrightYearInfo, &Extended::Data::copyrightYear,
+        minNumeric, maxCopyrightYear
+    };
+
+    /// @brief Describes the intro length field.
+    inline constexpr FieldDescriptor introLengthField
+    {
+        "Intro Length (ticks)", "Intro Length (ticks)*",
+        FieldKind::Numeric, nullptr,
+        &Extended::introLengthInfo, &Extended::Data::introLength,
+        minNumeric, maxTicks
+    };
+
+    /// @brief Describes the loop length field.
+    inline constexpr FieldDescriptor loopLengthField
+    {
+        "Loop Length (ticks)", "Loop Length (ticks)*",
+        FieldKind::Numeric, nullptr,
+        &Extended::loopLengthInfo, &Extended::Data::loopLength,
+        minNumeric, maxTicks
+    };
+
+    /// @brief Describes the end length field.
+    inline constexpr FieldDescriptor endLengthField
+    {
+        "End Length (ticks)", "End Length (ticks)*",
+        FieldKind::Numeric, nullptr,
+        &Extended::endLengthInfo, &Extended::Data::endLength,
+        minNumeric, maxTicks
+    };
+
+    /// @brief Describes the extended fade length field.
+    inline constexpr FieldDescriptor fadeLengthExtField
+    {
+        "Fade Length (ticks)", "Fade Length (ticks)*",
+        FieldKind::Numeric, nullptr,
+        &Extended::fadeLengthInfo, &Extended::Data::fadeLength,
+        minNumeric, maxTicks
+    };
+
+    /// @brief Describes the muted voices field.
+    inline constexpr FieldDescriptor mutedVoicesField
+    {
+        "Muted Voices", "Muted Voices*",
+        FieldKind::Binary, nullptr,
+        &Extended::mutedVoicesInfo, &Extended::Data::mutedVoices, 0, 0
+    };
+
+    /// @brief Describes the loop times field.
+    inline constexpr FieldDescriptor loopTimesField
+    {
+        "Loop Times", "Loop Times*",
+        FieldKind::Numeric, nullptr, &Extended::loopTimesInfo,
+        &Extended::Data::loopTimes, minNumeric, maxLoopTimes
+    };
+
+    /// @brief Describes the preamp level field.
+    inline constexpr FieldDescriptor preampLevelField
+    {
+        "Preamp Level", "Preamp Level*",
+        FieldKind::Numeric, nullptr,
+        &Extended::preampLevelInfo, &Extended::Data::preampLevel,
+        minPreampLevel, maxPreampLevel
+    };
+
+    /// @brief Every field of the ID666 tag, in the order Tag exposes them.
+    inline constexpr std::array<const FieldDescriptor*, 22> fieldDescriptors
+    {
+        &songTitleField, &gameTitleField, &dumperNameField, &commentsField,
+        &dateDumpedField, &songLengthField, &fadeLengthField,
+        &songArtistField, &defaultDisabledChannelsField, &emulatorUsedField,
+        &ostTitleField, &ostDiscField, &ostTrackField, &publisherNameField,
+        &copyrightYearField, &introLengthField, &loopLengthField,
+        &endLengthField, &fadeLengthExtField, &mutedVoicesField,
+        &loopTimesField, &preampLevelField
+    };
+
+    /// @brief Finds the field held by the extended item with the given id.
+    /// @param id The id of the extended item.
+    /// @return The descriptor of the field, or null if no field uses the id.
+    constexpr const FieldDescriptor* FindExtendedField(uint32_t id)
+    {
+        for (const FieldDescriptor* field : fieldDescriptors)
+        {
+            if (field->IsExtended() && field->item->id == id)
+            {
+                return field;
+            }
+        }
+
+        return nullptr;
+    }
+}
+
+#endif
@@ -0,0 +1,41 @@
+// Capture.h - Declares the Spc::Id666::Pattern::Capture struct.
+//
+// Copyright (C) 2026 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef SPC_ID666_PATTERN_CAPTURE_H
+#define SPC_ID666_PATTERN_CAPTURE_H
+
+#include <string_view>
+#include "Spc/Id666/FieldDescriptor.h"
+
+namespace Spc::Id666::Pattern
+{
+    /// @brief The text a placeholder matched in a file name.
+    ///
+    /// The value is a view of the file name that was matched, so the file
+    /// name must outlive the capture.
+    struct Capture
+    {
+        /// @brief The tag field of the placeholder.
+        const FieldDescriptor* field;
+
+        /// @brief The portion of the file name the placeholder matched.
+        ///
+        /// Space padding added by the placeholder's format is not included.
+        std::string_view value;
+    };
+}
+
+#endif
@@ -0,0 +1,100 @@
+// Compiled.h - Declares the Spc::Id666::Pattern::Compiled class.
+//
+// Copyright (C) 2026 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef SPC_ID666_PATTERN_COMPILED_H
+#define SPC_ID666_PATTERN_COMPILED_H
+
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "Capture.h"
+#include "Segment.h"
+#include "Spc/Id666/Tag.h"
+
+namespace Spc::Id666::Pattern
+{
+    /// @brief A file name pattern that has been lexed and parsed once.
+    ///
+    /// Compiling a pattern runs the Lexer and Parser a single time and
+    /// resolves each placeholder to the tag field it stands for, so the same
+    /// object can be applied to any number of files without repeating that
+    /// work. 
+    ///
+    /// @invariant The object does not change after it is constructed, so it
+    ///            can be shared between threads without synchronization.
+    ///            The tags it formats are not covered by this; see Tag.
+    class Compiled
+    {
+    public:
+        /// @brief Constructor; compiles the specified pattern.
+        /// @param pattern The pattern string to compile.
+        explicit Compiled(std::string_view pattern);
+
+        /// @brief Gets the pattern string the object was compiled from.
+        /// @return The pattern string.
+        const std::string& Source() const { return source; }
+
+        /// @brief Gets the segments of the pattern in order.
+        /// @return The segments, ending with an End segment.
+        const std::vector<Segment>& Segments() const { return segments; }
+
+        /// @brief Determines if every placeholder is supported.
+        /// @return True if every placeholder has a field, otherwise false.
+        bool IsValid() const { return valid; }
+
+        /// @brief Matches a file name against the pattern.
+        ///
+        /// Text placeholders match any characters, numeric placeholders 
+        /// match digits and track placeholders match digits followed by an
+        /// optional letter. Space padding added by a placeholder's format
+        /// is matched and left out of the value, while zero padding is kept
+        /// as part of a number. When a literal also appears inside a value,
+        /// the match backtracks rather than failing, so "%song% - %track%" 
+        /// matches "A - B - 3" with a song title of "A - B". When more than
+        /// one match is possible, text placeholders take the shortest value
+        /// and numeric ones the longest, earliest placeholder first.
+        ///
+        /// The match runs in time linear in the length of the file name for
+        /// a given pattern and does not copy the file name.
+        ///
+        /// @param fileName The file name to match.
+        /// @return The value of every placeholder in pattern order, or 
+        ///         std::nullopt if the file name does not match.
+        std::optional<std::vector<Capture>> Match(
+            std::string_view fileName) const;
+
+        /// @brief Formats a file name from the fields of a tag.
+        ///
+        /// The output string is cleared before the file name is written to
+        /// it, so reusing the same string for many tags keeps its capacity.
+        /// Each placeholder's value is still read from the tag into a new
+        /// string before it is appended, so formatting is not free of
+        /// allocations.
+        ///
+        /// @param tag The tag to take the placeholder values from.
+        /// @param output The string to write the file name to.
+        /// @return True if the file name was written, false if the pattern
+        ///         is not valid.
+        bool Format(const Tag& tag, std::string& output) const;
+    private:
+        std::string source;
+        std::vector<Segment> segments;
+        bool valid;
+    };
+}
+
+#endif
@@ -22,6 +22,13 @@ namespace Spc::Id666::Pattern
     /// @brief The character used to denote the start and end of a placeholder.
     inline const char placeholderChar{ '%' };
 
+    /// @brief The character that separates a placeholder from its format.
+    inline const char formatChar{ ':' };
+
+    /// @brief The character that separates the parts of a date in a file 
+    ///        name, in place of the '/' that cannot appear in one.
+    inline const char dateSeparatorChar{ '-' };
+
     /// @brief The placeholder for the song title in the pattern.  
     extern const char* songPlaceholder;
 
@@ -36,6 +43,57 @@ namespace Spc::Id666::Pattern
 
     /// @brief The placeholder for the track number in the pattern.
     extern const char* trackPlaceholder;
+
+    /// @brief The placeholder for the dumper name in the pattern.
+    extern const char* dumperPlaceholder;
+
+    /// @brief The placeholder for the comments in the pattern.
+    extern const char* commentsPlaceholder;
+
+    /// @brief The placeholder for the date dumped in the pattern.
+    extern const char* datePlaceholder;
+
+    /// @brief The placeholder for the song length in the pattern.
+    extern const char* lengthPlaceholder;
+
+    /// @brief The placeholder for the fade length in the pattern.
+    extern const char* fadePlaceholder;
+
+    /// @brief The placeholder for the default disabled channels.
+    extern const char* channelsPlaceholder;
+
+    /// @brief The placeholder for the emulator used in the pattern.
+    extern const char* emulatorPlaceholder;
+
+    /// @brief The placeholder for the OST title in the pattern.
+    extern const char* ostPlaceholder;
+
+    /// @brief The placeholder for the publisher name in the pattern.
+    extern const char* publisherPlaceholder;
+
+    /// @brief The placeholder for the copyright year in the pattern.
+    extern const char* yearPlaceholder;
+
+    /// @brief The placeholder for the intro length in the pattern.
+    extern const char* introPlaceholder;
+
+    /// @brief The placeholder for the loop length in the pattern.
+    extern const char* loopPlaceholder;
+
+    /// @brief The placeholder for the end length in the pattern.
+    extern const char* endPlaceholder;
+
+    /// @brief The placeholder for the extended fade length in the pattern.
+    extern const char* fadeTicksPlaceholder;
+
+    /// @brief The placeholder for the muted voices in the pattern.
+    extern const char* mutedPlaceholder;
+
+    /// @brief The placeholder for the number of loops in the pattern.
+    extern const char* loopsPlaceholder;
+
+    /// @brief The placeholder for the preamp level in the pattern.
+    extern const char* preampPlaceholder;
 }
 
 #endif
\ No newline at end of file
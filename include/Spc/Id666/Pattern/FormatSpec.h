@@ -0,0 +1,74 @@
+// FormatSpec.h - Declares the Spc::Id666::Pattern::FormatSpec struct.
+//
+// Copyright (C) 2026 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#ifndef SPC_ID666_PATTERN_FORMAT_SPEC_H
+#define SPC_ID666_PATTERN_FORMAT_SPEC_H
+
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <string_view>
+
+namespace Spc::Id666::Pattern
+{
+    /// @brief The widest a placeholder can be padded to by its format.
+    inline constexpr size_t maxFormatWidth{ 255 };
+
+    /// @brief Describes how a placeholder's value is padded in a file name.
+    ///
+    /// A placeholder can carry a format after the format character, such as
+    /// "%track:02%". The format is an optional '-' to pad on the right
+    /// rather than the left, an optional '0' to pad with zeros rather than
+    /// spaces, and the minimum width of the value. Values that are already
+    /// as wide as the width are never truncated.
+    struct FormatSpec
+    {
+        /// @brief The minimum number of characters the value occupies.
+        size_t width;
+
+        /// @brief The character the value is padded with.
+        char fill;
+
+        /// @brief True to pad on the right, false to pad on the left.
+        bool leftAlign;
+
+        /// @brief Determines if a value's padding can be told apart from it.
+        ///
+        /// Zeros can be a real part of a value, such as the title "007", so
+        /// only space padding is stripped when a file name is matched.
+        ///
+        /// @return True if the value is padded with spaces.
+        bool IsTrimmed() const { return width > 0 && fill == ' '; }
+
+        /// @brief Appends a value to a string, padded to the width.
+        /// @param output The string to append the value to.
+        /// @param value The value to append.
+        void Append(std::string& output, std::string_view value) const;
+
+        /// @brief Removes the padding from a value matched in a file name.
+        /// @param value The value that was matched.
+        /// @return The value without its padding.
+        std::string_view Trim(std::string_view value) const;
+    };
+
+    /// @brief Parses the format of a placeholder.
+    /// @param format The text after the format character, such as "02".
+    /// @return The parsed format, or std::nullopt if the format is invalid.
+    std::optional<FormatSpec> ParseFormat(std::string_view format);
+}
+
+#endif
@@ -19,6 +19,7 @@
 
 #include <string>
 #include "NodeType.h"
+#include "Placeholder.h"
 
 namespace Spc::Id666::Pattern
 {
@@ -34,6 +35,14 @@ namespace Spc::Id666::Pattern
 
         /// @brief The type of syntax node this is (e.g., literal, placeholder).
         NodeType type;
+
+        /// @brief The placeholder the node stands for.
+        ///
+        /// This is null for literals and for unsupported placeholders.
+        const Placeholder* placeholder;
+
+        /// @brief The format of a placeholder, such as "02" in "%track:02%".
+        std::string_view format;
     };
 }
 
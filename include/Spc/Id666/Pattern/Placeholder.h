@@ -0,0 +1,69 @@
+// Placeholder.h - Declares the Spc::Id666::Pattern::Placeholder struct.
+//
+// Copyright (C) 2026 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#ifndef SPC_ID666_PATTERN_PLACEHOLDER_H
+#define SPC_ID666_PATTERN_PLACEHOLDER_H
+
+#include <array>
+#include <string>
+#include <string_view>
+#include "Constants.h"
+#include "Spc/Id666/FieldDescriptor.h"
+#include "Spc/Id666/Tag.h"
+
+namespace Spc::Id666::Pattern
+{
+    /// @brief Ties a placeholder in a pattern to the tag field it stands for.
+    struct Placeholder
+    {
+        /// @brief The placeholder, including the placeholder characters.
+        const char* name;
+
+        /// @brief The tag field the placeholder is replaced with.
+        const FieldDescriptor* field;
+    };
+
+    /// @brief Every supported placeholder, one for each tag field.
+    extern const std::array<Placeholder, fieldDescriptors.size()> 
+        placeholders;
+
+    /// @brief Finds the placeholder with the given name.
+    /// @param name The name without placeholder characters, such as "track".
+    /// @return The placeholder, or nullptr if the name is not supported.
+    const Placeholder* FindPlaceholder(std::string_view name);
+
+    /// @brief Gets the value of a field as it appears in a file name.
+    ///
+    /// This is the field's value, except that the '/' separators of a date
+    /// are replaced with dateSeparatorChar, since a file name cannot hold
+    /// them. FileNameToTagValue() reverses the change.
+    ///
+    /// @param tag The tag to get the value from.
+    /// @param field The field to get the value of.
+    /// @return The value of the field for a file name.
+    std::string TagToFileNameValue(const Tag& tag, 
+                                   const FieldDescriptor& field);
+
+    /// @brief Converts a value taken from a file name back to a field value.
+    /// @param field The field the value is for.
+    /// @param value The value as it appears in the file name.
+    /// @return The value to set the field to.
+    std::string FileNameToTagValue(const FieldDescriptor& field, 
+                                   std::string_view value);
+}
+
+#endif
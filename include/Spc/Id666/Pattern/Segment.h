@@ -0,0 +1,48 @@
+// Segment.h - Declares the Spc::Id666::Pattern::Segment struct.
+//
+// Copyright (C) 2026 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef SPC_ID666_PATTERN_SEGMENT_H
+#define SPC_ID666_PATTERN_SEGMENT_H
+
+#include <string>
+#include "FormatSpec.h"
+#include "NodeType.h"
+#include "Spc/Id666/FieldDescriptor.h"
+
+namespace Spc::Id666::Pattern
+{
+    /// @brief Represents one part of a compiled pattern.
+    ///
+    /// Unlike a Node, a segment owns its text, so it stays valid after the
+    /// pattern string it was compiled from is gone, and placeholders are
+    /// already resolved to the tag field they stand for.
+    struct Segment
+    {
+        /// @brief The type of the segment (e.g., literal, placeholder).
+        NodeType type;
+
+        /// @brief The literal text or placeholder name of the segment.
+        std::string lexeme;
+
+        /// @brief The tag field of a placeholder, or nullptr if unsupported.
+        const FieldDescriptor* field;
+
+        /// @brief How the value of a placeholder is padded.
+        FormatSpec format;
+    };
+}
+
+#endif
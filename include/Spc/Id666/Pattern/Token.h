@@ -59,6 +59,23 @@ namespace Spc::Id666::Pattern
         /// @brief Returns the portion of the pattern this token represents.
         /// @return The lexeme of this token.
         std::string_view Lexeme() const { return lexeme; }
+
+        /// @brief Returns the name of a placeholder token.
+        ///
+        /// The name is the text between the placeholder characters, up to
+        /// the format character if there is one. For example, the name of
+        /// "%track:02%" is "track".
+        ///
+        /// @return The name, or an empty view if this is not a placeholder.
+        std::string_view Name() const;
+
+        /// @brief Returns the format of a placeholder token.
+        ///
+        /// The format is the text after the format character, so the format
+        /// of "%track:02%" is "02".
+        ///
+        /// @return The format, or an empty view if the token has none.
+        std::string_view Format() const;
     private:
         std::string_view lexeme;
     };
@@ -17,14 +17,21 @@
 #ifndef SPC_ID666_TAG_H
 #define SPC_ID666_TAG_H
 
+#include <algorithm>
 #include <memory>
+#include <optional>
 #include <string>
+#include <type_traits>
+#include "Spc/ByteView.h"
+#include "Spc/Id666/TagRecord.h"
 #include "Spc/Id666/TagType.h"
 #include "Spc/Id666/TagFieldInfo.h"
+#include "Spc/Id666/FieldDescriptor.h"
 #include "Spc/TextField.h"
 #include "Spc/Id666/Extended/ItemInfo.h"
 #include "Spc/Id666/Extended/Data.h"
 #include "Spc/Id666/Extended/Item.h"
+#include "Spc/Id666/Extended/ItemTable.h"
 
 namespace Spc::Id666
 {
@@ -37,41 +44,35 @@ namespace Spc::Id666
     /// @brief The offset in the file where the ID666 tag begins.
     inline constexpr size_t tagOffset{ 0x2E };
 
-    /// @brief The minimum value for numeric fields in the tag.
-    inline constexpr size_t minNumeric{ 0 };
-
-    /// @brief The minimum value for preamp level field in the tag.
-    inline constexpr size_t minPreampLevel{ 32768 };
-
-    /// @brief The maximum length of a song, in seconds, allowed.
-    inline constexpr size_t maxSongLength{ 959 };
-
-    /// @brief The maximum length of a fade, in milliseconds, allowed.
-    inline constexpr size_t maxFadeLength{ 59999 };
-
-    /// @brief The maximum disc number allowed.
-    inline constexpr size_t maxDiscNumber{ 9 };
-
-    /// @brief The maximum track number allowed.
-    inline constexpr size_t maxTrackNumber{ 99 };
-
-    /// @brief The maximum number of song loops allowed.
-    inline constexpr size_t maxLoopTimes{ 9 };
-
-    /// @brief The maximum preamp level allowed.
-    inline constexpr size_t maxPreampLevel{ 524288 };
-
-    /// @brief The maximum number of ticks used for extended tag timings.
-    inline constexpr size_t maxTicks{ 383999999 };
-
     /// @brief The maximum length of a string field allowed.
     inline constexpr size_t maxStringSize{ 256 };
 
+    /// @brief Throws an exception if the specified value is out of range.
+    /// @param value A string representation of the numeric value to check.
+    /// @param min The minimum value of the range.
+    /// @param max The maximum value of the range.
+    /// @throws std::invalid_argument if value is not numeric.
+    /// @throws std::out_of_range if value is outside [min, max].
+    void CheckRange(const std::string& value, int min, int max);
+
+    /// @brief Throws an exception if the specified value is out of range.
+    /// @param value The numeric value to check.
+    /// @param min The minimum value of the range.
+    /// @param max The maximum value of the range.
+    /// @throws std::out_of_range if value is outside [min, max].
+    void CheckRange(int64_t value, int64_t min, int64_t max);
+
     /// @brief Represents an ID666 tag in an SPC file.
     /// @invariant The internal field and extended data pointers are
     ///            initialized by the constructor.
     /// @invariant If a tag's field is empty or unused, accessors return a
     ///            field with an empty value and/or IsPresent() == false.
+    ///
+    /// Some const methods update shared internal state: Type() caches the
+    /// tag type, and reading an extended field decodes items given to
+    /// SetExtendedItems(). Copies of a tag share that state as well, so
+    /// reading the same tag, or copies of it, from more than one thread at
+    /// a time needs external synchronization.
     class Tag
     {
     public:
@@ -85,8 +86,25 @@ namespace Spc::Id666
         /// the fields can vary depending on the tag type. The BufferStream
         /// allows for more flexible reading and writing of the field data.
         ///
+        /// Since the caller may write to the field data through the pointer, 
+        /// getting it also discards the cached tag type. Get the pointer again
+        /// after any other call on the tag before writing through it.
+        ///
         /// @return A pointer to the tag's field data.
-        std::shared_ptr<Binary::BufferStream> FieldData() const
+        std::shared_ptr<Binary::BufferStream> FieldData()
+        {
+            cachedType->reset();
+            return fieldData;
+        }
+
+        /// @brief Gets a read-only pointer to the raw field data of the tag.
+        ///
+        /// Unlike the non-const overload, this keeps the cached tag type, so
+        /// reading the field data does not make the next Type() call scan it
+        /// again.
+        ///
+        /// @return A read-only pointer to the tag's field data.
+        std::shared_ptr<const Binary::BufferStream> FieldData() const
         {
             return fieldData;
         }
@@ -96,21 +114,105 @@ namespace Spc::Id666
         bool HasExtendedData() const;
 
         /// @brief Gets a pointer to the extended data structure of the tag.
+        ///
+        /// Items given to SetExtendedItems() that have not been read yet are
+        /// decoded into the structure first.
+        ///
         /// @return A pointer if the tag has extended data, otherwise nullptr.
         std::shared_ptr<Extended::Data> ExtendedData() const
         {
+            DecodeLoadedItems();
             return extendedData;
         }
 
+        /// @brief Replaces the extended data with the specified items.
+        ///
+        /// The items are kept in their flat form, and each one is only decoded
+        /// into the extended data structure when its field is first read or
+        /// written, so loading a tag does not pay for items that are never
+        /// read.
+        ///
+        /// @param items The items to give the tag.
+        /// @post The tag's previous extended items are discarded.
+        void SetExtendedItems(Extended::ItemTable items);
+
+        /// @brief Gets the extended items of the tag in their flat form.
+        /// @return A table holding a copy of every extended item.
+        Extended::ItemTable ExtendedItems() const;
+
+        /// @brief Gets the number of extended items that are not decoded yet.
+        /// @return The number of items still in their flat form.
+        size_t UndecodedItemCount() const { return loadedItems->Count(); }
+
         /// @brief Determines if the tag has text, binary, or mixed type values.
         ///
         /// The tag type determines the offsets and formats of the fields in the
         /// tag. The field accessor and mutator methods will use the tag type to
         /// determine how to read and write the fields.
         ///
+        /// The type is detected once and then cached until the bytes that
+        /// determine it are written to, so repeated calls are cheap.
+        ///
         /// @return The type of the tag.
         TagType DetermineType() const;
 
+        /// @brief Determines the type of the tag stored in the raw tag bytes.
+        ///
+        /// This inspects the bytes in place, without building any fields or 
+        /// allocating memory, and is what the non-static overload uses.
+        ///
+        /// @param data The tagSize bytes of a tag, starting at tagOffset.
+        /// @return The type of the tag.
+        /// @throws std::out_of_range if fewer than tagSize bytes are given.
+        static TagType DetermineType(ByteView data);
+
+        /// @brief Determines the type of the tag using the portable kernel.
+        ///
+        /// DetermineType(ByteView) classifies the bytes with SIMD 
+        /// instructions where the platform has them. This always classifies
+        /// them one byte at a time and gives the same result, so the two 
+        /// kernels can be checked against each other.
+        ///
+        /// @param data The tagSize bytes of a tag, starting at tagOffset.
+        /// @return The type of the tag.
+        /// @throws std::out_of_range if fewer than tagSize bytes are given.
+        static TagType DetermineTypeScalar(ByteView data);
+
+        /// @brief Decodes every field of the tag as plain values in one pass.
+        ///
+        /// Unlike the individual getters, this does not create any fields;
+        /// the values are read straight from the tag's bytes and the
+        /// extended items. Items that have not been read yet are viewed in 
+        /// their flat form and stay undecoded.
+        ///
+        /// @return A Spc::Id666::TagRecord holding the value of every field.
+        TagRecord Decode() const;
+
+        /// @brief Gets the value of the field with the given descriptor.
+        ///
+        /// This is the same value as calling Value() on the field returned
+        /// by the field's getter, so generic code can read any field of the 
+        /// tag by walking fieldDescriptors.
+        ///
+        /// @param descriptor The descriptor of the field to get.
+        /// @return The value of the field as a string.
+        /// @throws std::invalid_argument if the descriptor is not one of
+        ///         fieldDescriptors.
+        std::string FieldValue(const FieldDescriptor& descriptor) const;
+
+        /// @brief Sets the value of the field with the given descriptor.
+        ///
+        /// The value goes through the same path as the field's string setter,
+        /// so it is checked in the same way.
+        ///
+        /// @param descriptor The descriptor of the field to set.
+        /// @param value The value to set the field to.
+        /// @throws std::invalid_argument if the descriptor is not one of
+        ///         fieldDescriptors, or as the field's setter does.
+        /// @throws std::out_of_range as the field's setter does.
+        void SetFieldValue(const FieldDescriptor& descriptor, 
+                           const std::string& value);
+
         /// @brief Gets the title of the song.
         /// @return A TextField representing the song title.
         ///         If the song title is stored in both the header and the 
@@ -280,6 +382,75 @@ namespace Spc::Id666
         /// @return A NumericField representing the preamp level.
         NumericField PreampLevel() const;
 
+        /// @brief Gets the length of the song as a number.
+        ///
+        /// A binary tag stores an empty field as zero bytes, so a length of 0
+        /// cannot be told apart from no length and is reported as empty. A 
+        /// text tag stores 0 as a digit, so it is reported as 0.
+        ///
+        /// @return The length of the song in seconds, or std::nullopt if the
+        ///         field is empty.
+        std::optional<uint32_t> SongLengthValue() const;
+
+        /// @brief Gets the length of the fade as a number.
+        ///
+        /// As with SongLengthValue(), a length of 0 in a binary tag is 
+        /// reported as empty.
+        ///
+        /// @return The length of the fade in milliseconds, or std::nullopt if
+        ///         the field is empty.
+        std::optional<uint32_t> FadeLengthValue() const;
+
+        /// @brief Gets the date the SPC file was dumped as a Date.
+        /// @return The date dumped, or std::nullopt if it is not set or can't
+        ///         be interpreted as a date.
+        std::optional<Date> DateDumpedValue() const;
+
+        /// @brief Gets the OST disc number as a number.
+        /// @return The disc number, or std::nullopt if the item is not present.
+        std::optional<uint8_t> OstDiscValue() const;
+
+        /// @brief Gets the OST track number as a number.
+        ///
+        /// The track suffix, if any, is available from OstTrack().Suffix().
+        ///
+        /// @return The track number, or std::nullopt if the item is not 
+        ///         present.
+        std::optional<uint8_t> OstTrackValue() const;
+
+        /// @brief Gets the copyright year as a number.
+        /// @return The year, or std::nullopt if the item is not present.
+        std::optional<uint16_t> CopyrightYearValue() const;
+
+        /// @brief Gets the intro length as a number.
+        /// @return The length in ticks, or std::nullopt if the item is not 
+        ///         present.
+        std::optional<uint32_t> IntroLengthValue() const;
+
+        /// @brief Gets the loop length as a number.
+        /// @return The length in ticks, or std::nullopt if the item is not 
+        ///         present.
+        std::optional<uint32_t> LoopLengthValue() const;
+
+        /// @brief Gets the end length as a number.
+        /// @return The length in ticks, or std::nullopt if the item is not 
+        ///         present.
+        std::optional<uint32_t> EndLengthValue() const;
+
+        /// @brief Gets the extended fade length as a number.
+        /// @return The length in ticks, or std::nullopt if the item is not 
+        ///         present.
+        std::optional<uint32_t> FadeLengthExtValue() const;
+
+        /// @brief Gets the number of times the song loops as a number.
+        /// @return The loop times, or std::nullopt if the item is not present.
+        std::optional<uint8_t> LoopTimesValue() const;
+
+        /// @brief Gets the preamp level as a number.
+        /// @return The preamp level, or std::nullopt if the item is not 
+        ///         present.
+        std::optional<uint32_t> PreampLevelValue() const;
+
         /// @brief Sets the title of the song.
         /// @param value The value to set the song title to.
         /// @pre Value must be empty or <= 256 characters.
@@ -563,10 +734,103 @@ namespace Spc::Id666
         /// @throws std::out_of_range if value is out of range.
         void SetPreampLevel(const std::string& value);
 
+        /// @brief Sets the length of the song from a number.
+        ///
+        /// Unlike SetSongLength(const std::string&), the value is written 
+        /// straight to the tag without being parsed from a string first.
+        ///
+        /// @param seconds The length of the song, in seconds.
+        /// @pre Seconds must be between 0 and 959.
+        /// @throws std::out_of_range if seconds is out of range.
+        void SetSongLength(uint32_t seconds);
+
+        /// @brief Sets the length of the fade from a number.
+        /// @param milliseconds The length of the fade, in milliseconds.
+        /// @pre Milliseconds must be between 0 and 59999.
+        /// @throws std::out_of_range if milliseconds is out of range.
+        void SetFadeLength(uint32_t milliseconds);
+
+        /// @brief Sets the date the SPC file was dumped from a Date.
+        /// @pre The date must be valid; see Date::IsValid().
+        /// @throws std::invalid_argument if the date is not valid.
+        void SetDateDumped(const Date& date);
+
+        /// @brief Sets the OST disc number from a number.
+        /// @param disc The disc number.
+        /// @pre Disc must be between 0 and 9.
+        /// @throws std::out_of_range if disc is out of range.
+        void SetOstDisc(uint8_t disc);
+
+        /// @brief Sets the OST track number from a number and suffix.
+        /// @param track The track number.
+        /// @param suffix The character following the track number, or 0 for
+        ///               none.
+        /// @pre Track must be between 0 and 99.
+        /// @throws std::out_of_range if track is out of range.
+        void SetOstTrack(uint8_t track, char suffix = 0);
+
+        /// @brief Sets the copyright year from a number.
+        /// @param year The copyright year.
+        void SetCopyrightYear(uint16_t year);
+
+        /// @brief Sets the intro length from a number.
+        /// @param ticks The intro length, in ticks.
+        /// @pre Ticks must be between 0 and 383999999.
+        /// @throws std::out_of_range if ticks is out of range.
+        void SetIntroLength(uint32_t ticks);
+
+        /// @brief Sets the loop length from a number.
+        /// @param ticks The loop length, in ticks.
+        /// @pre Ticks must be between 0 and 383999999.
+        /// @throws std::out_of_range if ticks is out of range.
+        void SetLoopLength(uint32_t ticks);
+
+        /// @brief Sets the end length from a number.
+        /// @param ticks The end length, in ticks.
+        /// @pre Ticks must be between 0 and 383999999.
+        /// @throws std::out_of_range if ticks is out of range.
+        void SetEndLength(uint32_t ticks);
+
+        /// @brief Sets the extended fade length from a number.
+        /// @param ticks The fade length, in ticks.
+        /// @pre Ticks must be between 0 and 383999999.
+        /// @throws std::out_of_range if ticks is out of range.
+        void SetFadeLengthExt(uint32_t ticks);
+
+        /// @brief Sets the number of times the song loops from a number.
+        /// @param times The number of times the song loops.
+        /// @pre Times must be between 0 and 9.
+        /// @throws std::out_of_range if times is out of range.
+        void SetLoopTimes(uint8_t times);
+
+        /// @brief Sets the preamp level from a number.
+        /// @param level The preamp level.
+        /// @pre Level must be between 32768 and 524288.
+        /// @throws std::out_of_range if level is out of range.
+        void SetPreampLevel(uint32_t level);
+
     private:
         std::shared_ptr<Binary::BufferStream> fieldData;
         std::shared_ptr<Extended::Data> extendedData;
 
+        // Items given to SetExtendedItems() that extendedData does not hold
+        // yet. Shared like extendedData so copies decode them only once.
+        std::shared_ptr<Extended::ItemTable> loadedItems;
+
+        /// @brief Decodes any loaded items into the extended data structure.
+        /// @post loadedItems is empty.
+        void DecodeLoadedItems() const;
+
+        /// @brief Decodes the loaded item of a field, if there is one.
+        /// @param descriptor The descriptor of the field.
+        /// @pre The field has an extended item.
+        /// @post loadedItems does not hold the field's item.
+        void DecodeLoadedItem(const FieldDescriptor& descriptor) const;
+
+        // The cached type is shared just like fieldData, so copies of a tag 
+        // that share field data also see each other's invalidations.
+        std::shared_ptr<std::optional<TagType>> cachedType;
+
         /// @brief Reads a field from the binary buffer stream of the tag.
         ///
         /// This method preserves the position of the buffer stream so it
@@ -594,6 +858,54 @@ namespace Spc::Id666
         /// @post The buffer stream's position is unchanged.
         void WriteField(const Field& field);
 
+        /// @brief Writes raw bytes to the binary buffer stream of the tag.
+        /// @param offset The offset of the bytes within the SPC file.
+        /// @param bytes The bytes to write.
+        /// @post The cached tag type is reset if the bytes could change it.
+        void WriteBytes(size_t offset, ByteView bytes);
+
+        /// @brief Gets the bytes of a field in the non-extended tag data.
+        /// @param info The offset / sizes of both text and binary versions.
+        /// @param type The type of the tag, which selects the offset / size.
+        /// @return A view of the field's bytes within the tag.
+        ByteView FieldBytes(const TagFieldInfo& info, TagType type) const;
+
+        /// @brief Gets the number held by a numeric field.
+        ///
+        /// The extended item is preferred when it exists, just like the field
+        /// getters.
+        ///
+        /// @param descriptor The descriptor of the field to get.
+        /// @return The number, or no value if the field is not present.
+        std::optional<uint32_t> NumberValue(
+            const FieldDescriptor& descriptor) const;
+
+        /// @brief Writes a number to a numeric field in the non-extended tag.
+        ///
+        /// Text tags get the number as ASCII digits while binary and mixed 
+        /// tags get it in little endian byte order, just like 
+        /// WriteNumericField().
+        ///
+        /// @param info The offset / sizes of both text and binary versions.
+        /// @param value The number to write.
+        void WriteNumber(const TagFieldInfo& info, uint32_t value);
+
+        /// @brief Writes a number to the data of an extended length item.
+        /// @param descriptor The descriptor of the field to write.
+        /// @param value The number to write.
+        /// @pre The field has an extended length item.
+        /// @post The extended item is created or updated.
+        void WriteExtendedLength(const FieldDescriptor& descriptor, 
+                                 uint16_t value);
+
+        /// @brief Writes a number to an extended integer item.
+        /// @param descriptor The descriptor of the field to write.
+        /// @param value The number to write.
+        /// @pre The field has an extended integer item.
+        /// @post The extended item is created or updated.
+        void WriteExtendedInt(const FieldDescriptor& descriptor, 
+                              uint32_t value);
+
         /// @brief Reads a text field from the non-extended tag data only.
         ///
         /// This method provides a common way for reading text fields from the
@@ -604,24 +916,15 @@ namespace Spc::Id666
         /// @tparam T The type of the field to read.
         /// @param label The label the read field should have.
         /// @param info The offset / sizes of both text and binary versions.
-        /// @return A shared pointer to the field read from the tag.
+        /// @return The field read from the tag.
         /// @pre The specified field info is correct for the desired field.
         template<typename T>
-        std::shared_ptr<T> ReadTextField(const std::string& label, 
-                                         const TagFieldInfo& info) const
+        T ReadTextField(const std::string& label, 
+                        const TagFieldInfo& info) const
         {
-            std::shared_ptr<T> field;
-
-            if (DetermineType() == TagType::Binary)
-            {
-                field = std::make_shared<T>(label, info.binary);
-            }
-            else
-            {
-                field = std::make_shared<T>(label, info.text);
-            }
-
-            ReadField(*field);
+            bool isBinary = DetermineType() == TagType::Binary;
+            T field{ label, isBinary ? info.binary : info.text };
+            ReadField(field);
             return field;
         }
 
@@ -635,119 +938,26 @@ namespace Spc::Id666
         /// @tparam T The type of the field to read.
         /// @param label The label the read field should have.
         /// @param info The offset / sizes of both text and binary versions.
-        /// @return A shared pointer to the field read from the tag.
+        /// @return The field read from the tag.
         /// @pre The specified field info is correct for the desired field.
         template<typename T>
-        std::shared_ptr<T> ReadNumericField(const std::string& label, 
-                                            const TagFieldInfo& info) const
+        T ReadNumericField(const std::string& label, 
+                           const TagFieldInfo& info) const
         {
-            std::shared_ptr<T> field;
-
             TagType type = DetermineType();
+            T field{ label, type == TagType::Binary ? info.binary : info.text };
 
-            if (type == TagType::Binary)
-            {
-                field = std::make_shared<T>(label, info.binary);
-                field->SetType(NumericType::Binary);
-            }
-            else if (type == TagType::TextMixed)
-            {
-                field = std::make_shared<T>(label, info.text);
-                field->SetType(NumericType::Binary);
-            }
-            else
-            {
-                field = std::make_shared<T>(label, info.text);
-                field->SetType(NumericType::Text);
-            }
-
-            ReadField(*field);
-            return field;
-        }
-
-        /// @brief Reads a text field from extended or non-extended tag data.
-        ///
-        /// This method provides a common way for reading text fields from 
-        /// either the non-extended tag data or the extended tag data, 
-        /// automatically selecting the correct offsets and sizes based on the 
-        /// tag type and whether the extended item is available. If the extended
-        /// item is available, the extended tag data will be used instead of the
-        /// non-extended tag data. This method should be used to read fields
-        /// that exist in both the non-extended tag data and the extended tag 
-        /// data.
-        ///
-        /// @tparam T The type of the field to read.
-        /// @param label The label the read field should have.
-        /// @param info The offset / sizes of both text and binary versions.
-        /// @param item The extended item to read from, if available.
-        /// @return A shared pointer to the field read from the tag.
-        /// @pre The specified field info is correct for the desired field.
-        template<typename T>
-        std::shared_ptr<T> ReadExtendedTextField(
-            const std::string& label, 
-            const TagFieldInfo& info, 
-            const Extended::Item* item) const
-        {
-            std::shared_ptr<T> field;
-
-            if (item != nullptr)
-            {
-                field = ReadExtendedField<T>(label, item);
-            }
-            else
-            {
-                field = ReadTextField<T>(label, info);
-            }
-
-            if (field == nullptr)
-            {
-                field = std::make_shared<T>(label, info.text);
-                return field;
-            }
-            
-            return field;
-        }
-
-        /// @brief Reads a numeric field from extended or non-extended tag data.
-        ///
-        /// This method provides a common way for reading numeric fields from 
-        /// either the non-extended tag data or the extended tag data, 
-        /// automatically selecting the correct offsets and sizes based on the 
-        /// tag type and whether the extended item is available. If the extended
-        /// item is available, the extended tag data will be used instead of the
-        /// non-extended tag data. This method should be used to read fields
-        /// that exist in both the non-extended tag data and the extended tag 
-        /// data.
-        ///
-        /// @tparam T The type of the field to read.
-        /// @param label The label the read field should have.
-        /// @param info The offset / sizes of both text and binary versions.
-        /// @param item The extended item to read from, if available.
-        /// @return A shared pointer to the field read from the tag.
-        /// @pre The specified field info is correct for the desired field.
-        template<typename T>
-        std::shared_ptr<T> ReadExtendedNumericField(
-            const std::string& label, 
-            const TagFieldInfo& info, 
-            const Extended::Item* item) const
-        {
-            std::shared_ptr<T> field;
-
-            if (item != nullptr)
+            // Mixed tags use the text offsets but store binary numbers.
+            if (type == TagType::Text)
             {
-                field = ReadExtendedField<T>(label, item);
+                field.SetType(NumericType::Text);
             }
             else
             {
-                field = ReadNumericField<T>(label, info);
+                field.SetType(NumericType::Binary);
             }
 
-            if (field == nullptr)
-            {
-                field = std::make_shared<T>(label, info.text);
-                return field;
-            }
-            
+            ReadField(field);
             return field;
         }
 
@@ -758,49 +968,40 @@ namespace Spc::Id666
         /// exist in the extended tag data. 
         ///
         /// @tparam T The type of the field to read.
-        /// @param label The label the read field should have.
+        /// @param extendedLabel The label the read field should have, which
+        ///        is the descriptor's extendedLabel.
         /// @param item The extended item to read from.
-        /// @return A shared pointer to the field read from extended tag item.
+        /// @return The field read from the extended tag item.
         template<typename T>
-        std::shared_ptr<T> ReadExtendedField(const std::string& label, 
-                                             const Extended::Item* item) const
+        T ReadExtendedField(const char* extendedLabel, 
+                            const Extended::Item* item) const
         {
-            std::shared_ptr<T> field;
-
-            std::string extendedLabel = label + "*";
+            if (item == nullptr)
+            {
+                return T{ extendedLabel, Extended::dataInfo, false };
+            }
 
-            if (item != nullptr)
+            if (item->type->ToInt32() == Extended::lengthType)
             {
-                if (item->type->ToInt32() == Extended::lengthType)
-                {
-                    // Copy the raw data to a new field to ensure it is
-                    // interpreted according to the correct type T as item->data
-                    // is created as a NumericField, but may represent a
-                    // BinaryField or other type and needs to be recreated as
-                    // such. 
-                    field = std::make_shared<T>(extendedLabel, 
-                                                Extended::dataInfo);
-                    item->data->CopyRawDataTo(*field);
-                }
-                else if (item->extendedData != nullptr)
-                {
-                    field = std::static_pointer_cast<T>(item->extendedData);
-                    field->SetLabel(extendedLabel);
-                }
-                else
-                {
-                    field = std::make_shared<T>(extendedLabel, 
-                                                Extended::dataInfo);
-                }
+                // Copy the raw data to a new field to ensure it is
+                // interpreted according to the correct type T as item->data
+                // is created as a NumericField, but may represent a
+                // BinaryField or other type and needs to be recreated as
+                // such. 
+                T field{ extendedLabel, Extended::dataInfo };
+                item->data->CopyRawDataTo(field);
+                return field;
             }
-            else
+            else if (item->extendedData != nullptr)
             {
-                field = std::make_shared<T>(extendedLabel,
-                                            Extended::dataInfo,
-                                            false);
+                // Copy the stored field rather than relabeling it, so the 
+                // item itself is left untouched by reading it.
+                T field{ static_cast<const T&>(*item->extendedData) };
+                field.SetLabel(extendedLabel);
+                return field;
             }
 
-            return field;
+            return T{ extendedLabel, Extended::dataInfo };
         }
 
         /// @brief Writes to a text field in the non-extended tag data.
@@ -820,30 +1021,19 @@ namespace Spc::Id666
         template<typename T>
         void WriteTextField(const TagFieldInfo& info, const std::string& value)
         {
-            std::shared_ptr<T> field;
-
-            if (DetermineType() == TagType::Binary)
-            {
-                field = std::make_shared<T>("Temp", info.binary);
-            }
-            else
-            {
-                field = std::make_shared<T>("Temp", info.text);
-            }
+            bool isBinary = DetermineType() == TagType::Binary;
+            T field{ "Temp", isBinary ? info.binary : info.text };
 
             if (value.empty())
             {
-                for (int i = 0; i < field->Size(); i++)
-                {
-                    field->RawData()[i] = 0;
-                }
+                std::fill_n(field.RawData(), field.Size(), 0);
             }
             else
             {
-                field->SetValue(value);
+                field.SetValue(value);
             }
 
-            WriteField(*field);
+            WriteField(field);
         }
 
         /// @brief Writes to a numeric field in the non-extended tag data.
@@ -864,39 +1054,33 @@ namespace Spc::Id666
         void WriteNumericField(const TagFieldInfo& info,
                                const std::string& value)
         {
-            std::shared_ptr<T> field;
-
             TagType type = DetermineType();
+            T field{ "Temp", type == TagType::Binary ? info.binary 
+                                                     : info.text };
 
             if (type == TagType::Binary)
             {
-                field = std::make_shared<T>("Temp", info.binary);
-                field->SetType(Spc::NumericType::Binary);
+                field.SetType(Spc::NumericType::Binary);
             }
             else if (type == TagType::TextMixed)
             {
-                field = std::make_shared<T>("Temp", info.text);
-                field->SetType(Spc::NumericType::Either);
+                field.SetType(Spc::NumericType::Either);
             }
             else
             {
-                field = std::make_shared<T>("Temp", info.text);
-                field->SetType(Spc::NumericType::Text);
+                field.SetType(Spc::NumericType::Text);
             }
 
             if (value.empty())
             {
-                for (int i = 0; i < field->Size(); i++)
-                {
-                    field->RawData()[i] = 0;
-                }
+                std::fill_n(field.RawData(), field.Size(), 0);
             }
             else
             {
-                field->SetValue(value);
+                field.SetValue(value);
             }
 
-            WriteField(*field);
+            WriteField(field);
         }
 
         /// @brief Writes to text field in extended or non-extended tag data.
@@ -993,27 +1177,14 @@ namespace Spc::Id666
                 return;
             }
 
-            if (*(itemPtrPtr) == nullptr)
-            {
-                auto item = std::make_shared<Extended::Item>();
-                item->id->SetInt32(extendedInfo.id);
-                item->type->SetInt32(extendedInfo.type);
+            // Convert the value before touching the item so a value that 
+            // fails to convert leaves the tag unchanged.
+            T field{ "Temp", Extended::dataInfo };
+            field.SetType(Spc::NumericType::Binary);
+            field.SetValue(value);
 
-                auto field = std::make_shared<T>("Temp", Extended::dataInfo);
-                field->SetType(Spc::NumericType::Binary);
-                field->SetValue(value);
-                field->CopyRawDataTo(*item->data);
-
-                *(itemPtrPtr) = item;
-            }
-            else
-            {
-                auto item = *(itemPtrPtr);
-                auto field = std::make_shared<T>("Temp", Extended::dataInfo);
-                field->SetType(Spc::NumericType::Binary);
-                field->SetValue(value);
-                field->CopyRawDataTo(*item->data);
-            }
+            Extended::Item& item = FindOrCreateItem(extendedInfo, itemPtrPtr);
+            field.CopyRawDataTo(*item.data);
         }
 
         /// @brief Writes integer value to extended tag data only.
@@ -1044,41 +1215,14 @@ namespace Spc::Id666
                 return;
             }
 
-            if (*(itemPtrPtr) == nullptr)
-            {
-                auto item = std::make_shared<Extended::Item>();
-                item->id->SetInt32(extendedInfo.id);
-                item->type->SetInt32(extendedInfo.type);
-
-                auto data = std::static_pointer_cast<NumericField>(item->data);
-                data->SetInt32(Extended::integerSize);
-
-                Spc::FieldInfo info;
-                info.offset = Extended::dataOffset;
-                info.size = Extended::integerSize;
-                auto field = std::make_shared<T>("Temp", info);
-                field->SetType(Spc::NumericType::Binary);
-                field->SetValue(value);
-                item->extendedData = field;
-
-                *(itemPtrPtr) = item; 
-            }
-            else
-            {
-                auto item = *(itemPtrPtr);
-
-                std::shared_ptr<NumericField> data = item->data;
-
-                data->SetInt32(Extended::integerSize);
-                Spc::FieldInfo info;
-                info.offset = Extended::dataOffset;
-                info.size = Extended::integerSize;
-                item->extendedData = std::make_shared<T>("Temp", info);
+            Spc::FieldInfo info{ Extended::dataOffset, Extended::integerSize };
+            T field{ "Temp", info };
+            field.SetType(Spc::NumericType::Binary);
+            field.SetValue(value);
 
-                auto extData = std::static_pointer_cast<T>(item->extendedData);
-                extData->SetType(Spc::NumericType::Binary);
-                extData->SetValue(value);
-            }
+            Extended::Item& item = FindOrCreateItem(extendedInfo, itemPtrPtr);
+            item.data->SetInt32(Extended::integerSize);
+            StoreExtendedData(item, field);
         }
 
         /// @brief Writes string value to extended tag data only.
@@ -1117,79 +1261,272 @@ namespace Spc::Id666
                     "Value exceeds maximum string size for extended data.");
             }
 
-            if (*(itemPtrPtr) == nullptr)
+            Spc::FieldInfo info{ Extended::dataOffset, value.size() };
+            T field{ "Temp", info };
+            field.SetValue(value);
+
+            Extended::Item& item = FindOrCreateItem(extendedInfo, itemPtrPtr);
+            item.data->SetUInt32(static_cast<uint32_t>(value.size()));
+            StoreExtendedData(item, field);
+
+            // Strings are padded so the next item starts on a 4-byte boundary.
+            size_t paddingSize = (4 - value.size() % 4) % 4;
+
+            if (paddingSize == 0)
             {
-                auto item = std::make_shared<Extended::Item>();
-                item->id->SetInt32(extendedInfo.id);
-                item->type->SetInt32(extendedInfo.type);
+                item.padding = nullptr;
+            }
+            else if (item.padding != nullptr && 
+                     item.padding->Size() == paddingSize)
+            {
+                std::fill_n(item.padding->RawData(), paddingSize, 0);
+            }
+            else
+            {
+                FieldInfo paddingInfo{ Extended::dataOffset, paddingSize };
+                item.padding = std::make_shared<TextField>("Padding", 
+                                                           paddingInfo);
+            }
+        }
 
-                auto data = std::static_pointer_cast<NumericField>(item->data);
+        /// @brief Finds the extended item of a field without decoding it.
+        ///
+        /// Unlike ItemPointer(), an item that has not been read yet stays in
+        /// its flat form and is viewed where it is, so nothing is allocated.
+        ///
+        /// @param descriptor The descriptor of the field.
+        /// @return A view of the item, or no value if the field has no item.
+        /// @pre The field has an extended item.
+        std::optional<Extended::ItemView> FindItem(
+            const FieldDescriptor& descriptor) const
+        {
+            const Extended::Item* item = 
+                (extendedData.get()->*descriptor.member).get();
 
-                data->SetUInt32(static_cast<uint32_t>(value.size()));
-                Spc::FieldInfo info{ Extended::dataOffset, value.size() };
-                auto field = std::make_shared<T>("Temp", info);
-                field->SetValue(value);
-                item->extendedData = field;
+            if (item != nullptr)
+            {
+                return Extended::ViewOf(*item);
+            }
 
-                if (value.size() % 4 != 0)
-                { 
-                    size_t paddingSize{ 0 };
+            return loadedItems->Find(descriptor.item->id);
+        }
 
-                    while ((value.size() + paddingSize) % 4 != 0)
-                    {
-                        paddingSize++;
-                    }
+        /// @brief Gets the extended item pointer that holds a field.
+        /// @param descriptor The descriptor of the field.
+        /// @return A pointer to the extended item shared pointer.
+        /// @pre The field has an extended item.
+        std::shared_ptr<Extended::Item>* ItemPointer(
+            const FieldDescriptor& descriptor) const
+        {
+            DecodeLoadedItem(descriptor);
+            return &(extendedData.get()->*descriptor.member);
+        }
 
-                    FieldInfo paddingInfo{ Extended::dataOffset, paddingSize };
-                    item->padding = std::make_shared<TextField>("Padding", 
-                                                                paddingInfo);
-                }
-                else
-                {
-                    item->padding = nullptr;
-                }
+        /// @brief Reads the field described by a field descriptor.
+        ///
+        /// The field is read from its extended item when the item exists and 
+        /// from the non-extended tag data otherwise. Fields that only exist in
+        /// the extended tag are returned as not present when there is no item.
+        ///
+        /// @tparam T The type of the field to read.
+        /// @param descriptor The descriptor of the field to read.
+        /// @return The field read from the tag.
+        template<typename T>
+        T ReadTagField(const FieldDescriptor& descriptor) const
+        {
+            const Extended::Item* item = nullptr;
 
-                *(itemPtrPtr) = item;  
+            if (descriptor.IsExtended())
+            {
+                item = ItemPointer(descriptor)->get();
             }
-            else
+
+            if (item != nullptr || !descriptor.InTag())
             {
-                auto item = *(itemPtrPtr);
+                return ReadExtendedField<T>(descriptor.extendedLabel, item);
+            }
 
-                auto data = std::static_pointer_cast<NumericField>(item->data);
+            if constexpr (std::is_base_of_v<NumericField, T>)
+            {
+                if (descriptor.kind != FieldKind::Binary)
+                {
+                    return ReadNumericField<T>(descriptor.label, 
+                                               *descriptor.info);
+                }
+            }
+
+            return ReadTextField<T>(descriptor.label, *descriptor.info);
+        }
+
+        /// @brief Reads the field described by a field descriptor.
+        ///
+        /// Dates, emulators and binary fields are kept as integers in their
+        /// extended items, so an item is converted to the field's own type.
+        /// Every other field is read by ReadTagField().
+        ///
+        /// @tparam T The type of field for the descriptor's kind.
+        /// @param descriptor The descriptor of the field to read.
+        /// @return The field read from the tag.
+        template<typename T>
+        T ReadField(const FieldDescriptor& descriptor) const
+        {
+            if constexpr (std::is_same_v<T, DateField> || 
+                          std::is_same_v<T, EmulatorField> ||
+                          std::is_same_v<T, BinaryField>)
+            {
+                const Extended::Item* item = descriptor.IsExtended() ? 
+                                             ItemPointer(descriptor)->get() :
+                                             nullptr;
 
-                data->SetUInt32(static_cast<uint32_t>(value.size()));
-                Spc::FieldInfo info{ Extended::dataOffset,  value.size() };
-                item->extendedData = std::make_shared<T>("Temp", info);
-                item->extendedData->SetValue(value);
+                if (item != nullptr)
+                {
+                    NumericField value = ReadExtendedField<NumericField>(
+                        descriptor.extendedLabel, item);
+                    Spc::FieldInfo extendedInfo{ 
+                        Extended::dataOffset, 
+                        descriptor.InTag() ? descriptor.info->binary.size : 1 
+                    };
+                    T field{ value.Label(), extendedInfo };
+                    value.CopyRawDataTo(field);
+                    return field;
+                }
 
-                if (value.size() % 4 != 0)
+                if (!descriptor.InTag())
                 {
-                    size_t paddingSize{ 0 };
+                    Spc::FieldInfo errorInfo{ 0, 1 };
+                    return T{ descriptor.extendedLabel, errorInfo, false };
+                }
+            }
 
-                    while ((value.size() + paddingSize) % 4 != 0)
-                    {
-                        paddingSize++;
-                    }
+            return ReadTagField<T>(descriptor);
+        }
 
-                    FieldInfo paddingInfo{ Extended::dataOffset, paddingSize };
-                    item->padding = std::make_shared<TextField>("Padding",
-                                                                paddingInfo);
+        /// @brief Checks a value against the rules of the descriptor's kind
+        ///        and writes it to the field.
+        /// @param descriptor The descriptor of the field to write.
+        /// @param value The value to write to the field.
+        /// @throws std::invalid_argument if the value is not valid.
+        /// @throws std::out_of_range if the value is out of range.
+        void WriteField(const FieldDescriptor& descriptor, 
+                        const std::string& value);
+
+        /// @brief Removes the extended item of a field if the value is empty.
+        /// @param descriptor The descriptor of the field.
+        /// @param value The value being written to the field.
+        void ClearItemIfEmpty(const FieldDescriptor& descriptor, 
+                              const std::string& value);
+
+        /// @brief Checks a track number with an optional letter suffix.
+        /// @param descriptor The descriptor of the track field.
+        /// @param value The value to check.
+        /// @throws std::invalid_argument if the value is not a track number.
+        /// @throws std::out_of_range if the number is out of range.
+        static void CheckTrack(const FieldDescriptor& descriptor, 
+                               const std::string& value);
+
+        /// @brief Writes the field described by a field descriptor.
+        ///
+        /// Text fields in the non-extended tag also get an extended item when
+        /// the value does not fit. Other fields are written to the 
+        /// non-extended tag if they have a location there, and to their 
+        /// extended item otherwise. An empty value clears the field. Values 
+        /// of numeric fields are checked against the descriptor's range 
+        /// before anything is written.
+        ///
+        /// @tparam T The type of the field to write.
+        /// @param descriptor The descriptor of the field to write.
+        /// @param value The value to write to the field.
+        /// @throws std::invalid_argument if a numeric value is not numeric.
+        /// @throws std::out_of_range if the value is out of range.
+        template<typename T>
+        void WriteTagField(const FieldDescriptor& descriptor, 
+                           const std::string& value)
+        {
+            if constexpr (std::is_base_of_v<NumericField, T>)
+            {
+                if (!value.empty() && descriptor.HasRange() && 
+                    descriptor.kind == FieldKind::Numeric)
+                {
+                    CheckRange(value, 
+                               static_cast<int>(descriptor.min), 
+                               static_cast<int>(descriptor.max));
+                }
+
+                if (descriptor.InTag())
+                {
+                    WriteNumericField<T>(*descriptor.info, value);
+                }
+                else if (descriptor.item->type == Extended::lengthType)
+                {
+                    WriteExtendedLengthField<T>(*descriptor.item, 
+                                                ItemPointer(descriptor),
+                                                value);
                 }
                 else
                 {
-                    item->padding = nullptr;
+                    WriteExtendedIntField<T>(*descriptor.item, 
+                                             ItemPointer(descriptor),
+                                             value);
                 }
             }
+            else if (descriptor.InTag())
+            {
+                WriteExtendedTextField<T>(*descriptor.info, 
+                                          *descriptor.item,
+                                          ItemPointer(descriptor),
+                                          value);
+            }
+            else
+            {
+                WriteExtendedStringField<T>(*descriptor.item, 
+                                            ItemPointer(descriptor),
+                                            value);
+            }
         }
-    };
 
-    /// @brief Throws an exception if the specified value is out of range.
-    /// @param value A string representation of the numeric value to check.
-    /// @param min The minimum value of the range.
-    /// @param max The maximum value of the range.
-    /// @throws std::invalid_argument if value is not numeric.
-    /// @throws std::out_of_range if value is outside [min, max].
-    void CheckRange(const std::string& value, int min, int max);
+        /// @brief Gets an extended item, creating it if it doesn't exist.
+        /// @param extendedInfo The id and type to give a new item.
+        /// @param itemPtrPtr A pointer to the extended item shared pointer.
+        /// @return A reference to the existing or newly created item.
+        Extended::Item& FindOrCreateItem(
+            Extended::ItemInfo extendedInfo,
+            std::shared_ptr<Extended::Item>* itemPtrPtr)
+        {
+            if (*(itemPtrPtr) == nullptr)
+            {
+                auto item = std::make_shared<Extended::Item>();
+                item->id->SetInt32(extendedInfo.id);
+                item->type->SetInt32(extendedInfo.type);
+                *(itemPtrPtr) = item;
+            }
+
+            return **itemPtrPtr;
+        }
+
+        /// @brief Stores a field as the extended data of an item.
+        ///
+        /// If the item already holds extended data of the same type and size,
+        /// the field is assigned to it in place; otherwise the field is copied
+        /// into newly allocated storage owned by the item.
+        ///
+        /// @tparam T The type of the field to store.
+        /// @param item The item to store the field in.
+        /// @param field The field holding the value to store.
+        template<typename T>
+        void StoreExtendedData(Extended::Item& item, const T& field)
+        {
+            auto existing = dynamic_cast<T*>(item.extendedData.get());
+
+            if (existing != nullptr && existing->Size() == field.Size())
+            {
+                *existing = field;
+            }
+            else
+            {
+                item.extendedData = std::make_shared<T>(field);
+            }
+        }
+    };
 }
 
 #endif
\ No newline at end of file
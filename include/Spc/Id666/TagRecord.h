@@ -0,0 +1,109 @@
+// TagRecord.h - Declares the Spc::Id666::TagRecord struct.
+//
+// Copyright (C) 2026 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef SPC_ID666_TAG_RECORD_H
+#define SPC_ID666_TAG_RECORD_H
+
+#include <cstdint>
+#include <optional>
+#include <string_view>
+#include "Spc/Date.h"
+
+namespace Spc::Id666
+{
+    /// @brief A snapshot of every field in an ID666 tag as plain values.
+    ///
+    /// Produced by Tag::Decode(). Fields that can come from either the tag or
+    /// the extended data hold the extended value when there is one, exactly 
+    /// like the corresponding Tag getters. Fields that only exist in the 
+    /// extended data are empty when the item is not present.
+    ///
+    /// The strings are views into the tag's own buffers and are only valid 
+    /// until the tag is modified or destroyed.
+    struct TagRecord
+    {
+        /// @brief The title of the song.
+        std::string_view songTitle;
+
+        /// @brief The title of the game.
+        std::string_view gameTitle;
+
+        /// @brief The name of the person who dumped the SPC file.
+        std::string_view dumperName;
+
+        /// @brief The comments the tagger included in the tag.
+        std::string_view comments;
+
+        /// @brief The date the SPC file was dumped, if one is set.
+        std::optional<Date> dateDumped;
+
+        /// @brief The length of the song, in seconds.
+        uint32_t songLength{ 0 };
+
+        /// @brief The length of the song fade out, in milliseconds.
+        uint32_t fadeLength{ 0 };
+
+        /// @brief The name of the song artist.
+        std::string_view songArtist;
+
+        /// @brief The bitmask of channels disabled at startup.
+        uint8_t defaultDisabledChannels{ 0 };
+
+        /// @brief The emulator used: 0 for unknown, 1 for ZSNES, 2 for Snes9x.
+        uint8_t emulatorUsed{ 0 };
+
+        /// @brief The title of the original soundtrack (OST) album.
+        std::string_view ostTitle;
+
+        /// @brief The OST disc number.
+        std::optional<uint8_t> ostDisc;
+
+        /// @brief The OST track number.
+        std::optional<uint8_t> ostTrack;
+
+        /// @brief The character following the OST track number, or 0 if none.
+        char ostTrackSuffix{ 0 };
+
+        /// @brief The name of the publisher.
+        std::string_view publisherName;
+
+        /// @brief The year of the copyright.
+        std::optional<uint16_t> copyrightYear;
+
+        /// @brief The length of the introduction, in ticks.
+        std::optional<uint32_t> introLength;
+
+        /// @brief The length of the loop, in ticks.
+        std::optional<uint32_t> loopLength;
+
+        /// @brief The length of the end, in ticks.
+        std::optional<uint32_t> endLength;
+
+        /// @brief The length of the fade out, in ticks.
+        std::optional<uint32_t> fadeLengthExt;
+
+        /// @brief The bitmask of muted voices.
+        std::optional<uint8_t> mutedVoices;
+
+        /// @brief The number of times the loop is played.
+        std::optional<uint8_t> loopTimes;
+
+        /// @brief The preamp level.
+        std::optional<uint32_t> preampLevel;
+    };
+}
+
+#endif
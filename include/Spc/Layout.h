@@ -0,0 +1,106 @@
+// Layout.h - Declares the Spc::Layout class.
+//
+// Copyright (C) 2026 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#ifndef SPC_LAYOUT_H
+#define SPC_LAYOUT_H
+
+#include <filesystem>
+#include <optional>
+#include <string>
+#include <unordered_set>
+#include "Spc/Id666/Pattern/Compiled.h"
+#include "Spc/Id666/Tag.h"
+
+namespace Spc
+{
+    /// @brief Places files in a directory tree named after their tags.
+    ///
+    /// A layout pairs a compiled pattern with a root directory. Unlike the
+    /// patterns given to File::TagToFileName(), a '/' in a literal part of
+    /// the pattern separates directories, so "%game%/%disc%-%track% %song%"
+    /// places each file in a directory named after its game. Any '/', '\',
+    /// ':' or control character in a tag value is replaced with '_', so a
+    /// value can never add a directory or climb out of the root, and paths
+    /// with an empty, "." or ".." part are rejected.
+    ///
+    /// The layout remembers every directory it has created or found, so
+    /// placing many files into the same directories only creates each one
+    /// once. A layout is meant to be used by one thread at a time, such as
+    /// from a BatchLoader callback.
+    class Layout
+    {
+    public:
+        /// @brief The character tag values are sanitized with.
+        static constexpr char replacementChar{ '_' };
+
+        /// @brief Constructor; creates a layout under the specified root.
+        /// @param pattern The pattern of the path relative to the root.
+        /// @param root The directory the files are placed under.
+        Layout(const Id666::Pattern::Compiled& pattern, 
+               const std::filesystem::path& root);
+
+        /// @brief Gets the pattern of the path relative to the root.
+        /// @return The compiled pattern.
+        const Id666::Pattern::Compiled& Pattern() const { return pattern; }
+
+        /// @brief Gets the directory the files are placed under.
+        /// @return The root directory.
+        const std::filesystem::path& Root() const { return root; }
+
+        /// @brief Determines if the pattern can be used as a layout.
+        ///
+        /// Every placeholder must be supported, and the literals may not
+        /// contain '\' or ':', or start the pattern with '/'.
+        ///
+        /// @return True if the layout is valid, otherwise false.
+        bool IsValid() const { return valid; }
+
+        /// @brief Gets the path the layout gives a tag, without creating it.
+        /// @param tag The tag to take the placeholder values from.
+        /// @return The path under the root, or std::nullopt if the layout is
+        ///         invalid or the path has an empty, "." or ".." part.
+        std::optional<std::filesystem::path> Destination(
+            const Id666::Tag& tag) const;
+
+        /// @brief Gets the path the layout gives a tag and creates its 
+        ///        directory.
+        ///
+        /// Directories are only created if the layout has not already 
+        /// created or found them.
+        ///
+        /// @param tag The tag to take the placeholder values from.
+        /// @return The path under the root, or std::nullopt if there is no 
+        ///         path for the tag or its directory cannot be created.
+        std::optional<std::filesystem::path> Prepare(const Id666::Tag& tag);
+
+        /// @brief Gets the number of directories known to exist.
+        /// @return The number of directories created or found so far.
+        size_t KnownDirectories() const { return directories.size(); }
+    private:
+        Id666::Pattern::Compiled pattern;
+        std::filesystem::path root;
+        bool valid;
+        std::unordered_set<std::string> directories;
+
+        /// @brief Creates a directory and its parents if not already known.
+        /// @param directory The directory to create.
+        /// @return True if the directory exists, otherwise false.
+        bool EnsureDirectory(const std::filesystem::path& directory);
+    };
+}
+
+#endif
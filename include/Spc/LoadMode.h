@@ -0,0 +1,51 @@
+// LoadMode.h - Declares the Spc::LoadMode enum.
+//
+// Copyright (C) 2026 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef SPC_LOAD_MODE_H
+#define SPC_LOAD_MODE_H
+
+namespace Spc
+{
+    /// @brief Determines how Spc::File loads the file from disk.
+    enum class LoadMode
+    {
+        /// @brief Reads each section through the file stream into its buffer.
+        Stream,
+
+        /// @brief Maps the file into memory and views sections in place.
+        ///
+        /// The header, tag and extended data are decoded as usual, but the
+        /// RAM, DSP registers, unused area and extra RAM are not copied; they
+        /// are exposed as read-only views into the mapping instead.
+        Mapped,
+
+        /// @brief Reads only the header, tag and extended data.
+        ///
+        /// The RAM, DSP registers, unused area and extra RAM are skipped by
+        /// seeking straight to the extended data, so only a few hundred bytes
+        /// are read per file. The skipped sections are left untouched.
+        Metadata,
+
+        /// @brief Reads the whole file into one buffer, then parses it.
+        ///
+        /// The file is read through the file stream with a single read rather
+        /// than one read per field. The header, tag and extended data are then
+        /// parsed from the buffer with a bounds-checked Spc::ByteCursor.
+        Buffered
+    };
+}
+
+#endif
@@ -0,0 +1,58 @@
+// MappedFile.h - Declares the Spc::MappedFile class.
+//
+// Copyright (C) 2026 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef SPC_MAPPED_FILE_H
+#define SPC_MAPPED_FILE_H
+
+#include <string>
+#include "ByteView.h"
+
+namespace Spc
+{
+    /// @brief Maps a file on disk into memory for read-only access.
+    ///
+    /// The mapping is established when the object is constructed and released
+    /// when it is destroyed, so views obtained from View() are only valid for
+    /// the lifetime of the object. The file must not be truncated or rewritten
+    /// while it is mapped.
+    class MappedFile
+    {
+    public:
+        /// @brief Constructor; maps the specified file into memory.
+        /// @param path The path to the file on disk.
+        /// @throws FileOperationException if the file cannot be mapped.
+        explicit MappedFile(const std::string& path);
+
+        /// @brief Destructor; releases the mapping.
+        ~MappedFile();
+
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+
+        /// @brief Gets a view of the entire mapped file.
+        /// @return The read-only view of the file's bytes.
+        ByteView View() const { return ByteView{ data, size }; }
+
+        /// @brief Gets the size of the mapped file.
+        /// @return The size of the file, in bytes.
+        size_t Size() const { return size; }
+    private:
+        const char* data;
+        size_t size;
+    };
+}
+
+#endif
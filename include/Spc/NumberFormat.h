@@ -0,0 +1,80 @@
+// NumberFormat.h - Declares the number formatting and parsing functions.
+//
+// Copyright (C) 2026 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef SPC_NUMBER_FORMAT_H
+#define SPC_NUMBER_FORMAT_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace Spc
+{
+    /// @brief The most characters a 64-bit integer needs in decimal.
+    inline constexpr size_t maxIntegerDigits{ 20 };
+
+    /// @brief Formats an integer as decimal text.
+    ///
+    /// Unlike a std::stringstream, this does not depend on the locale and
+    /// does not allocate for any value that fits in the small string buffer.
+    ///
+    /// @param value The value to format.
+    /// @return The decimal representation of the value.
+    std::string FormatInteger(int64_t value);
+
+    /// @brief Formats an unsigned integer padded with leading zeros.
+    /// @param value The value to format.
+    /// @param width The minimum number of digits to write.
+    /// @param destination The buffer to write to, which must be large enough
+    ///                    for the larger of width and maxIntegerDigits.
+    /// @return The number of characters written.
+    size_t FormatPadded(uint32_t value, size_t width, char* destination);
+
+    /// @brief Writes an integer as text into a fixed size field.
+    ///
+    /// The digits are left aligned and the remainder of the field is filled
+    /// with zeros, which is how numbers are stored in text ID666 tags. If the
+    /// value has more digits than the field, it is truncated.
+    ///
+    /// @param value The value to write.
+    /// @param destination The field to write to.
+    /// @param size The size of the field.
+    void WriteDigits(int64_t value, char* destination, size_t size);
+
+    /// @brief Parses a 32-bit integer from text.
+    ///
+    /// This follows the rules of std::stoi: leading whitespace and a plus
+    /// sign are skipped and parsing stops at the first character that isn't
+    /// part of the number. It does not depend on the locale or allocate.
+    ///
+    /// @param text The text to parse.
+    /// @param base The base of the number.
+    /// @return The parsed value.
+    /// @throws std::invalid_argument if the text does not start with a number.
+    /// @throws std::out_of_range if the number does not fit in 32 bits.
+    int32_t ParseInt32(std::string_view text, int base = 10);
+
+    /// @brief Parses up to the specified number of leading decimal digits.
+    /// @param text The text to parse.
+    /// @param maxDigits The most digits to consume.
+    /// @param value Receives the parsed value if any digits were consumed.
+    /// @return The number of digits consumed, or 0 if text doesn't start with
+    ///         a digit.
+    size_t ParseDigits(std::string_view text, size_t maxDigits, uint32_t& value);
+}
+
+#endif
@@ -0,0 +1,69 @@
+// OnceFlag.h - Declares the Spc::OnceFlag class.
+//
+// Copyright (C) 2026 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef SPC_ONCE_FLAG_H
+#define SPC_ONCE_FLAG_H
+
+#include <memory>
+#include <mutex>
+#include <utility>
+
+namespace Spc
+{
+    /// @brief A std::once_flag that can be copied and reset.
+    ///
+    /// std::once_flag can be neither copied nor moved, so a class holding
+    /// one directly could not be copied either. A copy of a OnceFlag is a new
+    /// flag that has not been called yet, because whatever the call set up
+    /// belongs to the object that held the original.
+    class OnceFlag
+    {
+    public:
+        /// @brief Constructor; creates a flag that has not been called.
+        OnceFlag() : flag{ std::make_unique<std::once_flag>() } { }
+
+        /// @brief Copy constructor; creates a flag that has not been called.
+        OnceFlag(const OnceFlag&) : OnceFlag() { }
+
+        /// @brief Copy assignment; resets the flag.
+        /// @return A reference to this flag.
+        OnceFlag& operator=(const OnceFlag&)
+        {
+            Reset();
+            return *this;
+        }
+
+        /// @brief Calls a function unless it has been called through the flag.
+        ///
+        /// This is safe to call from several threads at once; only one runs
+        /// the function, and the others wait until it has finished.
+        ///
+        /// @param function The function to call.
+        template<typename Function>
+        void Call(Function&& function)
+        {
+            std::call_once(*flag, std::forward<Function>(function));
+        }
+
+        /// @brief Resets the flag so the next Call() runs its function.
+        /// @pre No other thread is calling Call() on the flag.
+        void Reset() { flag = std::make_unique<std::once_flag>(); }
+    private:
+        std::unique_ptr<std::once_flag> flag;
+    };
+}
+
+#endif
@@ -0,0 +1,42 @@
+// ProbeResult.h - Declares the Spc::ProbeResult struct.
+//
+// Copyright (C) 2026 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef SPC_PROBE_RESULT_H
+#define SPC_PROBE_RESULT_H
+
+#include <optional>
+#include "Id666/TagType.h"
+
+namespace Spc
+{
+    /// @brief Describes what File::Probe() found at the start of a file.
+    struct ProbeResult
+    {
+        /// @brief True if the header ID and separator identify an SPC file.
+        bool isSpc{ false };
+
+        /// @brief True if the header indicates that an ID666 tag is present.
+        bool containsTag{ false };
+
+        /// @brief The type Tag::DetermineType() would detect for the tag.
+        ///
+        /// This is only set when the file is an SPC file and all of the tag 
+        /// bytes were available.
+        std::optional<Id666::TagType> tagType;
+    };
+}
+
+#endif
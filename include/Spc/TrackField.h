@@ -17,7 +17,6 @@
 #ifndef SPC_TRACK_FIELD_H
 #define SPC_TRACK_FIELD_H
 
-#include <sstream>
 #include "NumericField.h"
 #include "FieldInfo.h"
 
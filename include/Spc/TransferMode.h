@@ -0,0 +1,58 @@
+// TransferMode.h - Declares the Spc::TransferMode enum.
+//
+// Copyright (C) 2026 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#ifndef SPC_TRANSFER_MODE_H
+#define SPC_TRANSFER_MODE_H
+
+namespace Spc
+{
+    /// @brief Determines how Spc::File::TagToFileName() creates the new file.
+    ///
+    /// Whichever mode is used, an existing file at the new name is never 
+    /// replaced.
+    enum class TransferMode
+    {
+        /// @brief Copies the file's bytes to the new name.
+        Copy,
+
+        /// @brief Renames the file, so only the new name is left.
+        ///
+        /// The Spc::File takes the new path and saves to it from then on.
+        /// If the new name is on another file system, the file is copied and
+        /// the original is removed. An existing file is never replaced, 
+        /// including on file systems without hard links such as FAT, where 
+        /// the new name is reserved before the rename. A Spc::File that was 
+        /// given its own Binary::FileStream cannot be moved.
+        Move,
+
+        /// @brief Links the new name to the same data as the file.
+        ///
+        /// No data is copied, but both names refer to one file, so changes
+        /// saved through either name are seen through both. The new name
+        /// must be on the same file system.
+        HardLink,
+
+        /// @brief Clones the file, sharing its data until either is changed.
+        ///
+        /// On Linux file systems that support it, such as btrfs and xfs, the
+        /// clone is made with the FICLONE ioctl and takes no extra space. 
+        /// Anywhere else the file is copied instead.
+        Clone
+    };
+}
+
+#endif
@@ -0,0 +1,238 @@
+// BatchLoader.cpp - Defines the Spc::BatchLoader class methods.
+//
+// Copyright (C) 2026 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "Spc/BatchLoader.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <filesystem>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include "Spc/FileOperationException.h"
+
+using namespace Spc;
+
+const char* directoryError{ "Unable to read directory." };
+
+namespace
+{
+    bool IsSpcFile(const std::filesystem::path& path)
+    {
+        std::string extension = path.extension().string();
+
+        std::transform(extension.begin(), 
+                       extension.end(), 
+                       extension.begin(),
+                       [](unsigned char c) { return std::tolower(c); });
+
+        return extension == ".spc";
+    }
+
+    template <typename Iterator>
+    void CollectFiles(Iterator iterator, std::vector<std::string>& paths)
+    {
+        std::error_code error;
+
+        // The iterator is advanced with an error code rather than in a 
+        // range-based for loop, which would throw std::filesystem_error.
+        while (iterator != Iterator{})
+        {
+            const std::filesystem::directory_entry& entry = *iterator;
+
+            if (entry.is_regular_file(error) && IsSpcFile(entry.path()))
+            {
+                paths.push_back(entry.path().string());
+            }
+
+            iterator.increment(error);
+
+            if (error)
+            {
+                throw FileOperationException(directoryError);
+            }
+        }
+    }
+}
+
+BatchLoader::BatchLoader(size_t workers, LoadMode mode) :
+    workers{ workers }, mode{ mode }
+{
+    if (this->workers == 0)
+    {
+        // hardware_concurrency() may return 0 when it cannot tell.
+        this->workers = std::max<size_t>(std::thread::hardware_concurrency(), 
+                                         1);
+    }
+}
+
+void BatchLoader::Load(const std::vector<std::string>& paths, 
+                       const Callback& callback) const
+{
+    Run(paths, [&callback](size_t, BatchResult result)
+    {
+        callback(std::move(result));
+    });
+}
+
+std::vector<BatchResult> BatchLoader::Load(
+    const std::vector<std::string>& paths) const
+{
+    std::vector<BatchResult> results(paths.size());
+
+    Run(paths, [&results](size_t index, BatchResult result)
+    {
+        results[index] = std::move(result);
+    });
+
+    return results;
+}
+
+void BatchLoader::Run(
+    const std::vector<std::string>& paths,
+    const std::function<void(size_t, BatchResult)>& callback) const
+{
+    std::atomic<size_t> next{ 0 };
+    std::atomic<bool> stopped{ false };
+    std::mutex callbackMutex;
+    std::exception_ptr callbackError;
+
+    auto work = [&]()
+    {
+        while (!stopped)
+        {
+            const size_t index = next++;
+
+            if (index >= paths.size())
+            {
+                return;
+            }
+
+            BatchResult result;
+            result.path = paths[index];
+
+            try
+            {
+                auto file = std::make_shared<File>(result.path);
+                file->Load(mode);
+                result.file = std::move(file);
+            }
+            catch (...)
+            {
+                result.error = std::current_exception();
+            }
+
+            std::lock_guard<std::mutex> lock{ callbackMutex };
+
+            if (stopped)
+            {
+                return;
+            }
+
+            try
+            {
+                callback(index, std::move(result));
+            }
+            catch (...)
+            {
+                callbackError = std::current_exception();
+                stopped = true;
+            }
+        }
+    };
+
+    const size_t threadCount = std::min(workers, paths.size());
+    std::vector<std::thread> threads;
+    threads.reserve(threadCount);
+
+    try
+    {
+        for (size_t i = 0; i < threadCount; i++)
+        {
+            threads.emplace_back(work);
+        }
+    }
+    catch (...)
+    {
+        // A std::thread that is still joinable when destroyed terminates the
+        // program, so the workers that did start are stopped and joined.
+        stopped = true;
+
+        for (std::thread& thread : threads)
+        {
+            thread.join();
+        }
+
+        throw;
+    }
+
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+
+    if (callbackError != nullptr)
+    {
+        std::rethrow_exception(callbackError);
+    }
+}
+
+void BatchLoader::LoadDirectory(const std::string& directory, 
+                                bool recursive,
+                                const Callback& callback) const
+{
+    Load(FindFiles(directory, recursive), callback);
+}
+
+std::vector<std::string> BatchLoader::FindFiles(const std::string& directory,
+                                                bool recursive)
+{
+    namespace fs = std::filesystem;
+
+    std::vector<std::string> paths;
+    std::error_code error;
+
+    if (recursive)
+    {
+        fs::recursive_directory_iterator iterator{ 
+            directory, 
+            fs::directory_options::skip_permission_denied, 
+            error 
+        };
+
+        if (error)
+        {
+            throw FileOperationException(directoryError);
+        }
+
+        CollectFiles(iterator, paths);
+    }
+    else
+    {
+        fs::directory_iterator iterator{ directory, error };
+
+        if (error)
+        {
+            throw FileOperationException(directoryError);
+        }
+
+        CollectFiles(iterator, paths);
+    }
+
+    std::sort(paths.begin(), paths.end());
+    return paths;
+}
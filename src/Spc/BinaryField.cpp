@@ -16,6 +16,8 @@
 
 #include "Spc/BinaryField.h"
 
+#include "Spc/NumberFormat.h"
+
 using namespace Spc;
 
 const char* emptyError{ "Value must not be empty."};
@@ -25,7 +27,6 @@ const char* binaryChars{ "01" };
 void BinaryField::SetValue(const std::string& value)
 {
     constexpr int base{ 2 };
-    constexpr size_t* nonNumericPos{ nullptr };
 
     if (value.empty())
     {
@@ -37,7 +38,7 @@ void BinaryField::SetValue(const std::string& value)
         throw std::invalid_argument{ binError };
     }
 
-    int dec = std::stoi(value, nonNumericPos, base);
+    int dec = ParseInt32(value, base);
 
     // BinaryField values should always be stored as binary bytes regardless
     // of the NumericType configured by callers.
@@ -0,0 +1,89 @@
+// ByteCursor.cpp - Defines the Spc::ByteCursor class methods.
+//
+// Copyright (C) 2026 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "Spc/ByteCursor.h"
+
+#include <cstring>
+#include "Spc/FileCorruptException.h"
+
+using namespace Spc;
+
+const char* endOfDataError{ "Unexpected end of data." };
+
+void ByteCursor::Seek(size_t p)
+{
+    if (p > bytes.Size())
+    {
+        throw FileCorruptException(endOfDataError);
+    }
+
+    position = p;
+}
+
+void ByteCursor::Skip(size_t count)
+{
+    if (count > Remaining())
+    {
+        throw FileCorruptException(endOfDataError);
+    }
+
+    position += count;
+}
+
+ByteView ByteCursor::Read(size_t count)
+{
+    if (count > Remaining())
+    {
+        throw FileCorruptException(endOfDataError);
+    }
+
+    ByteView view{ bytes.Data() + position, count };
+    position += count;
+    return view;
+}
+
+void ByteCursor::CopyTo(char* destination, size_t count)
+{
+    ByteView source = Read(count);
+
+    if (count > 0)
+    {
+        std::memcpy(destination, source.Data(), count);
+    }
+}
+
+uint8_t ByteCursor::ReadUInt8()
+{
+    return static_cast<uint8_t>(Read(1)[0]);
+}
+
+uint16_t ByteCursor::ReadUInt16()
+{
+    ByteView value = Read(2);
+
+    return static_cast<uint16_t>(static_cast<uint8_t>(value[0]) |
+                                 static_cast<uint8_t>(value[1]) << 8);
+}
+
+uint32_t ByteCursor::ReadUInt32()
+{
+    ByteView value = Read(4);
+
+    return static_cast<uint32_t>(static_cast<uint8_t>(value[0])) |
+           static_cast<uint32_t>(static_cast<uint8_t>(value[1])) << 8 |
+           static_cast<uint32_t>(static_cast<uint8_t>(value[2])) << 16 |
+           static_cast<uint32_t>(static_cast<uint8_t>(value[3])) << 24;
+}
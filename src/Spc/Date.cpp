@@ -0,0 +1,101 @@
+// Date.cpp - Defines the Spc::Date struct methods.
+//
+// Copyright (C) 2026 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "Spc/Date.h"
+
+#include <cctype>
+#include "Spc/NumberFormat.h"
+
+using namespace Spc;
+
+namespace
+{
+    constexpr char dateSeparator{ '/' };
+    constexpr size_t monthDigits{ 2 };
+    constexpr size_t dayDigits{ 2 };
+    constexpr size_t yearDigits{ 4 };
+
+    // Parses up to the specified number of digits followed by the specified
+    // separator, returning false if either is missing.
+    bool ParseComponent(std::string_view& text, size_t maxDigits, 
+                        uint32_t& value, char separator)
+    {
+        size_t count = ParseDigits(text, maxDigits, value);
+
+        if (count == 0 || count >= text.size() || text[count] != separator)
+        {
+            return false;
+        }
+
+        text.remove_prefix(count + 1);
+        return true;
+    }
+}
+
+void Date::Format(char* destination) const
+{
+    FormatPadded(month, monthDigits, destination);
+    destination[2] = dateSeparator;
+    FormatPadded(day, dayDigits, destination + 3);
+    destination[5] = dateSeparator;
+    FormatPadded(year, yearDigits, destination + 6);
+}
+
+std::string Date::ToString() const
+{
+    char text[textSize];
+    Format(text);
+    return std::string(text, textSize);
+}
+
+std::optional<Date> Date::Parse(std::string_view text)
+{
+    uint32_t month{ 0 };
+    uint32_t day{ 0 };
+    uint32_t year{ 0 };
+
+    if (!ParseComponent(text, monthDigits, month, dateSeparator) ||
+        !ParseComponent(text, dayDigits, day, dateSeparator))
+    {
+        return std::nullopt;
+    }
+
+    size_t count = ParseDigits(text, yearDigits, year);
+
+    if (count == 0)
+    {
+        return std::nullopt;
+    }
+
+    for (char c : text.substr(count))
+    {
+        if (!std::isspace(static_cast<unsigned char>(c)))
+        {
+            return std::nullopt;
+        }
+    }
+
+    Date date{ static_cast<uint16_t>(year), 
+               static_cast<uint8_t>(month), 
+               static_cast<uint8_t>(day) };
+
+    if (!date.IsValid())
+    {
+        return std::nullopt;
+    }
+
+    return date;
+}
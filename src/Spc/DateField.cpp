@@ -16,16 +16,19 @@
 
 #include "Spc/DateField.h"
 
+#include <algorithm>
+#include <string_view>
+#include "Spc/NumberFormat.h"
+
 using namespace Spc;
 
 constexpr int dateSize{ 11 };
 constexpr int asciiSlash{ 0x2F };
 constexpr int unusedAreaIndex{ 4 };
 constexpr int endIndex{ 10 };
-constexpr int beginningYear{ 1900 };
-const char* dateFormat{ "%m/%d/%Y" };
 const char* dateSizeError{ "DateField size must be at least 11." };
 const char* dateFormatError{ "Date value must be in MM/DD/YYYY format." };
+const char* invalidDateError{ "Date is not a valid calendar date." };
 
 DateField::DateField(const std::string& label, FieldInfo info, bool isPresent)
     : NumericField{ label, info, isPresent }
@@ -79,120 +82,109 @@ bool DateField::IsSet() const
     return false;
 }
 
-std::string DateField::ToString() const
+std::optional<Date> DateField::ToDate() const
 {
+    if (!IsSet())
+    {
+        return std::nullopt;
+    }
+
     if (IsText())
     {
-        return Binary::RawField::ToString(Binary::StringFormat::Terminated);
+        const char* end = std::find(rawData.get(), rawData.get() + size, 0);
+        return Date::Parse(std::string_view(rawData.get(), 
+                                            end - rawData.get()));
     }
 
-    Binary::UInt8Field day{ Binary::FieldEndianness::Little };
-    Binary::UInt8Field month{ Binary::FieldEndianness::Little };
-    Binary::UInt16Field year{ Binary::FieldEndianness::Little };
+    Date date = BinaryDate();
 
-    day.RawData()[0] = rawData[0];
-    month.RawData()[0] = rawData[1];
-    year.RawData()[0] = rawData[2];
-    year.RawData()[1] = rawData[3];
+    if (!date.IsValid())
+    {
+        return std::nullopt;
+    }
 
-    std::stringstream stream;
-    stream << std::setw(2) << std::setfill('0') << month.ToString() << '/'
-           << std::setw(2) << std::setfill('0') << day.ToString() << '/'
-           << std::setw(4) << std::setfill('0') << year.ToString();
-    return stream.str();
+    return date;
 }
 
-void DateField::SetValue(const std::string& value)
+std::string DateField::ToString() const
 {
-    if (Type() == NumericType::Text || Type() == NumericType::Either)
-    {
-        SetTextValue(value);
-    }
-    else
+    if (IsText())
     {
-        SetBinaryValue(value);
+        return Binary::RawField::ToString(Binary::StringFormat::Terminated);
     }
+
+    // The binary bytes aren't guaranteed to be a valid date, so this can't
+    // use Date::Format(), which expects exactly two digit months and days.
+    Date date = BinaryDate();
+
+    // Room for a 3 digit month and day, a 5 digit year and two slashes.
+    char text[13];
+    size_t length = FormatPadded(date.month, 2, text);
+    text[length++] = asciiSlash;
+    length += FormatPadded(date.day, 2, text + length);
+    text[length++] = asciiSlash;
+    length += FormatPadded(date.year, 4, text + length);
+    return std::string(text, length);
 }
 
-void DateField::SetTextValue(const std::string& value)
+void DateField::SetValue(const std::string& value)
 {
-    std::istringstream valueStream{ value };
-    std::tm date{};
-
-    valueStream >> std::get_time(&date, dateFormat);
+    std::optional<Date> date = Date::Parse(value);
 
-    if (!valueStream.fail())
+    if (!date.has_value())
     {
-        valueStream >> std::ws;
-
-        if (!valueStream.eof())
-        {
-            throw std::invalid_argument{ dateFormatError };
-        }
-
-        std::stringstream dateStream;
-
-        // We add 1 to date.tm_mon because January is stored as month 0, etc.
-        dateStream << std::setw(2) << std::setfill('0') << date.tm_mon + 1;
-        dateStream << "/";
-
-        dateStream << std::setw(2) << std::setfill('0') << date.tm_mday;
-        dateStream << "/";
+        throw std::invalid_argument{ dateFormatError };
+    }
 
-        // We add 1900 because years are stored as years since 1900.
-        dateStream << std::setw(4) << std::setfill('0') 
-                   << date.tm_year + beginningYear;
+    SetDate(*date);
+}
 
-        std::memcpy(rawData.get(), dateStream.str().c_str(), endIndex);
+void DateField::SetDate(const Date& date)
+{
+    if (!date.IsValid())
+    {
+        throw std::invalid_argument{ invalidDateError };
+    }
 
-        // The last byte of the 11 byte date field should always be null.
-        rawData[endIndex] = 0;
+    if (Type() == NumericType::Text || Type() == NumericType::Either)
+    {
+        SetTextDate(date);
     }
     else
     {
-        throw std::invalid_argument{ dateFormatError };
+        SetBinaryDate(date);
     }
 }
 
-void DateField::SetBinaryValue(const std::string& value)
+Date DateField::BinaryDate() const
 {
-    std::istringstream valueStream{ value };
-    std::tm date;
-
-    valueStream >> std::get_time(&date, dateFormat);
-
-    if (!valueStream.fail())
-    {
-        valueStream >> std::ws;
-
-        if (!valueStream.eof())
-        {
-            throw std::invalid_argument{ dateFormatError };
-        }
-
-        Binary::Int8Field day{ static_cast<int8_t>(date.tm_mday) };
+    Date date;
+    date.day = static_cast<uint8_t>(rawData[0]);
+    date.month = static_cast<uint8_t>(rawData[1]);
+    date.year = static_cast<uint16_t>(
+        static_cast<uint8_t>(rawData[2]) | 
+        static_cast<uint8_t>(rawData[3]) << Binary::bitsPerByte);
+    return date;
+}
 
-        // We add 1 to date.tm_mon because January is stored as month 0, etc.
-        Binary::Int8Field month{ static_cast<int8_t>(date.tm_mon + 1) };
+void DateField::SetTextDate(const Date& date)
+{
+    date.Format(rawData.get());
 
-        // We add 1900 because years are stored as years since 1900.
-        Binary::Int16Field year
-        { 
-            static_cast<int16_t>(date.tm_year + beginningYear) 
-        };
+    // The last byte of the 11 byte date field should always be null.
+    rawData[endIndex] = 0;
+}
 
-        rawData[0] = day.RawData()[0];
-        rawData[1] = month.RawData()[0];
-        std::memcpy(rawData.get() + 2, year.RawData(), 2);
+void DateField::SetBinaryDate(const Date& date)
+{
+    rawData[0] = static_cast<char>(date.day);
+    rawData[1] = static_cast<char>(date.month);
+    rawData[2] = static_cast<char>(date.year);
+    rawData[3] = static_cast<char>(date.year >> Binary::bitsPerByte);
 
-        // The remaining bytes should all be unused in a binary formatted date.
-        for (int i = unusedAreaIndex; i < dateSize; i++)
-        {
-            rawData[i] = 0;
-        }
-    }
-    else
+    // The remaining bytes should all be unused in a binary formatted date.
+    for (int i = unusedAreaIndex; i < dateSize; i++)
     {
-        throw std::invalid_argument{ dateFormatError };
+        rawData[i] = 0;
     }
 }
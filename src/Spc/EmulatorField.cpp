@@ -16,19 +16,21 @@
 
 #include "Spc/EmulatorField.h"
 
+#include "Spc/NumberFormat.h"
+
 using namespace Spc;
 
-constexpr int asciiZero{ 0x30 };
-constexpr int asciiOne{ 0x31 };
-constexpr int asciiTwo{ 0x32 };
+constexpr int unknownEmulator{ 0 };
+constexpr int zsnes{ 1 };
+constexpr int snes9x{ 2 };
 
 std::string EmulatorField::ToString() const
 {
     switch (DetectInt32())
     {
-        case 1:
+        case zsnes:
             return "ZSNES";
-        case 2:
+        case snes9x:
             return "SNES9X";
         default:
             return "Unknown";
@@ -37,34 +39,24 @@ std::string EmulatorField::ToString() const
 
 void EmulatorField::SetValue(const std::string& value)
 {
+    int emulator{ unknownEmulator };
+
+    if (value == "ZSNES")
+    {
+        emulator = zsnes;
+    }
+    else if (value == "SNES9X")
+    {
+        emulator = snes9x;
+    }
+
     if (Type() == NumericType::Binary)
     {
-        if (value == "ZSNES")
-        {
-            SetInt32(1);
-        }
-        else if (value == "SNES9X")
-        {
-            SetInt32(2);
-        }
-        else
-        {
-            SetInt32(0);
-        }
+        SetInt32(emulator);
     }
     else
     {
-        if (value == "ZSNES")
-        {
-            rawData[0] = asciiOne;
-        }
-        else if (value == "SNES9X")
-        {
-            rawData[0] = asciiTwo;
-        }
-        else
-        {
-            rawData[0] = asciiZero;
-        }
+        // Text emulator codes are a single ASCII digit.
+        WriteDigits(emulator, rawData.get(), 1);
     }
 }   
\ No newline at end of file
@@ -16,17 +16,46 @@
 
 #include "Spc/File.h"
 
+#include <fcntl.h>
+
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#ifdef __linux__
+#include <linux/fs.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#endif
+
+#include <cerrno>
+#include <cstdio>
+
+#include <algorithm>
+#include <string_view>
+#include <utility>
+#include <cstring>
 #include "Spc/Id666/Extended/ItemInfo.h"
 #include "Spc/Id666/Extended/Item.h"
+#include "Spc/Id666/Extended/ItemParser.h"
+#include "Spc/Id666/Pattern/Placeholder.h"
 #include "Spc/TextField.h"
 
 using namespace Spc;
 
-const char* extSizeError{ "Extended item size exceeds remaining chunk size." };
-const char* invalidTypeError{ "Invalid extended item type detected." };
 const char* unopenedFileError{ "File is not open." };
 const char* nullStreamError{ "File stream not initialized." };
-const char* invalidIdError{ "Invalid extended item ID detected." };
+const char* truncatedFileError{ "File is too small to be an SPC file." };
+const char* resizeError{ "Unable to resize file." };
+const char* bufferSizeError{ "Buffer is too small for the file." };
+const char* probeOpenError{ "Unable to open file for probing." };
+const char* probeReadError{ "Unable to read file for probing." };
+const char* sectionsNotLoadedError{ 
+    "File was loaded without its RAM and DSP registers." 
+};
 
 namespace
 {
@@ -70,15 +99,622 @@ namespace
 
         return true;
     }
+
+    bool CopyWithoutOverwrite(const std::filesystem::path& sourcePath, 
+                              const std::filesystem::path& destinationPath)
+    {
+        std::error_code error;
+        const bool copied = std::filesystem::copy_file(
+            sourcePath,
+            destinationPath,
+            std::filesystem::copy_options::none,
+            error);
+
+        return copied && !error;
+    }
+
+#ifndef _WIN32
+    // Determines if link() failed because the file system has no hard links,
+    // as with FAT, exFAT and many FUSE and SMB mounts.
+    bool IsLinkUnsupported(int error)
+    {
+        return error == EPERM || error == EOPNOTSUPP || error == ENOTSUP;
+    }
+
+    // Renames a file where hard links are not available. The destination is
+    // first created with O_EXCL, which fails if anything exists there, and
+    // the file is then renamed over that empty placeholder. Only a writer 
+    // that replaces the placeholder without O_EXCL in between can lose its
+    // file. Returns 0 on success or the error number of the failure.
+    int RenameOverPlaceholder(const std::filesystem::path& sourcePath, 
+                              const std::filesystem::path& destinationPath)
+    {
+        const int placeholder = open(destinationPath.c_str(), 
+                                     O_WRONLY | O_CREAT | O_EXCL, 
+                                     S_IRUSR | S_IWUSR);
+
+        if (placeholder < 0)
+        {
+            return errno;
+        }
+
+        close(placeholder);
+
+        if (rename(sourcePath.c_str(), destinationPath.c_str()) != 0)
+        {
+            const int error = errno;
+            unlink(destinationPath.c_str());
+            return error;
+        }
+
+        return 0;
+    }
+#endif
+
+    // Renames a file only if nothing exists at the destination, in one step
+    // so that a file created in the meantime is never replaced. Returns 0 on
+    // success or the error number of the failure.
+    int RenameWithoutOverwrite(const std::filesystem::path& sourcePath, 
+                               const std::filesystem::path& destinationPath)
+    {
+#ifdef _WIN32
+        // Unlike POSIX rename(), the Windows one fails if the file exists.
+        return _wrename(sourcePath.c_str(), destinationPath.c_str()) == 0 
+            ? 0 : errno;
+#else
+#if defined(__linux__) && defined(SYS_renameat2) && defined(RENAME_NOREPLACE)
+        if (syscall(SYS_renameat2, AT_FDCWD, sourcePath.c_str(), 
+                    AT_FDCWD, destinationPath.c_str(), 
+                    RENAME_NOREPLACE) == 0)
+        {
+            return 0;
+        }
+
+        // Older kernels and some file systems don't support the flag, so
+        // only those failures fall through to linking.
+        if (errno != EINVAL && errno != ENOSYS && errno != EOPNOTSUPP)
+        {
+            return errno;
+        }
+#endif
+        // link() fails if the destination exists, so linking the new name
+        // and then unlinking the old one never replaces a file either.
+        if (link(sourcePath.c_str(), destinationPath.c_str()) != 0)
+        {
+            if (!IsLinkUnsupported(errno))
+            {
+                return errno;
+            }
+
+            return RenameOverPlaceholder(sourcePath, destinationPath);
+        }
+
+        if (unlink(sourcePath.c_str()) != 0)
+        {
+            const int error = errno;
+            unlink(destinationPath.c_str());
+            return error;
+        }
+
+        return 0;
+#endif
+    }
+
+    bool MoveWithoutOverwrite(const std::filesystem::path& sourcePath, 
+                              const std::filesystem::path& destinationPath)
+    {
+        const int result = RenameWithoutOverwrite(sourcePath, 
+                                                  destinationPath);
+
+        if (result != EXDEV)
+        {
+            return result == 0;
+        }
+
+        // A file can't be renamed onto another file system, so copy it and
+        // remove the original instead, leaving things as they were if the
+        // original can't be removed.
+        if (!CopyWithoutOverwrite(sourcePath, destinationPath))
+        {
+            return false;
+        }
+
+        std::error_code error;
+
+        if (!std::filesystem::remove(sourcePath, error) || error)
+        {
+            std::filesystem::remove(destinationPath, error);
+            return false;
+        }
+
+        return true;
+    }
+
+    bool LinkWithoutOverwrite(const std::filesystem::path& sourcePath, 
+                              const std::filesystem::path& destinationPath)
+    {
+        std::error_code error;
+        std::filesystem::create_hard_link(sourcePath, destinationPath, error);
+
+        return !error;
+    }
+
+    bool CloneWithoutOverwrite(const std::filesystem::path& sourcePath, 
+                               const std::filesystem::path& destinationPath)
+    {
+#if defined(__linux__) && defined(FICLONE)
+        const int source = open(sourcePath.c_str(), O_RDONLY);
+        struct stat status;
+
+        if (source == -1 || fstat(source, &status) == -1)
+        {
+            if (source != -1)
+            {
+                close(source);
+            }
+
+            return false;
+        }
+
+        // O_EXCL keeps an existing file from being replaced.
+        const int destination = open(destinationPath.c_str(), 
+                                     O_WRONLY | O_CREAT | O_EXCL, 
+                                     status.st_mode & 07777);
+
+        if (destination == -1)
+        {
+            close(source);
+            return false;
+        }
+
+        const bool cloned = ioctl(destination, FICLONE, source) == 0;
+        close(source);
+        const bool closed = close(destination) == 0;
+
+        if (cloned && closed)
+        {
+            return true;
+        }
+
+        // The file system can't clone, or the files are on different file
+        // systems, so copy into the file that was just created instead.
+        std::error_code error;
+        const bool copied = closed && std::filesystem::copy_file(
+            sourcePath,
+            destinationPath,
+            std::filesystem::copy_options::overwrite_existing,
+            error);
+
+        if (!copied || error)
+        {
+            std::filesystem::remove(destinationPath, error);
+            return false;
+        }
+
+        return true;
+#else
+        return CopyWithoutOverwrite(sourcePath, destinationPath);
+#endif
+    }
+
+    // Creates the file at the destination from the source without ever
+    // replacing an existing file, failing if both are the same path.
+    bool Transfer(const std::filesystem::path& sourcePath, 
+                  const std::filesystem::path& destinationPath,
+                  TransferMode mode)
+    {
+        if (sourcePath == destinationPath)
+        {
+            return false;
+        }
+
+        switch (mode)
+        {
+            case TransferMode::Move:
+                return MoveWithoutOverwrite(sourcePath, destinationPath);
+            case TransferMode::HardLink:
+                return LinkWithoutOverwrite(sourcePath, destinationPath);
+            case TransferMode::Clone:
+                return CloneWithoutOverwrite(sourcePath, destinationPath);
+            case TransferMode::Copy:
+                break;
+        }
+
+        return CopyWithoutOverwrite(sourcePath, destinationPath);
+    }
+
+    // The extended data chunk header is a 4 byte ID and a 4 byte size.
+    constexpr size_t chunkIdSize{ 4 };
+    constexpr size_t chunkHeaderSize{ 8 };
+
+    // Probing uses the C runtime's unbuffered file functions directly, since
+    // the standard streams allocate a buffer for every file they open.
+    int OpenDescriptor(const std::string& path)
+    {
+#ifdef _WIN32
+        return _open(path.c_str(), _O_RDONLY | _O_BINARY);
+#else
+        return open(path.c_str(), O_RDONLY);
+#endif
+    }
+
+    long ReadDescriptor(int descriptor, char* buffer, size_t size)
+    {
+#ifdef _WIN32
+        return _read(descriptor, buffer, static_cast<unsigned>(size));
+#else
+        return static_cast<long>(read(descriptor, buffer, size));
+#endif
+    }
+
+    void CloseDescriptor(int descriptor)
+    {
+#ifdef _WIN32
+        _close(descriptor);
+#else
+        close(descriptor);
+#endif
+    }
+
+    void CopyFields(DataStructure& structure, ByteView bytes)
+    {
+        for (Field* field : structure.SpcFields())
+        {
+            ByteView source = bytes.Subview(field->Offset(), field->Size());
+            std::memcpy(field->RawData(), source.Data(), source.Size());
+        }
+    }
+}
+
+ProbeResult File::Probe(ByteView bytes)
+{
+    ProbeResult result;
+    const size_t idSize = std::strlen(headerId);
+
+    if (bytes.Size() < headerContainsTagInfo.offset + 
+                       headerContainsTagInfo.size ||
+        std::memcmp(bytes.Data(), headerId, idSize) != 0)
+    {
+        return result;
+    }
+
+    for (size_t i = 0; i < headerSeparatorInfo.size; i++)
+    {
+        if (bytes[headerSeparatorInfo.offset + i] != separatorChar)
+        {
+            return result;
+        }
+    }
+
+    result.isSpc = true;
+    result.containsTag = static_cast<uint8_t>(
+        bytes[headerContainsTagInfo.offset]) == headerContainsTag;
+
+    if (result.containsTag && 
+        bytes.Size() >= Id666::tagOffset + Id666::tagSize)
+    {
+        result.tagType = Id666::Tag::DetermineType(
+            bytes.Subview(Id666::tagOffset, Id666::tagSize));
+    }
+
+    return result;
+}
+
+ProbeResult File::Probe(const std::string& path)
+{
+    char buffer[ramInfo.offset];
+    const int descriptor = OpenDescriptor(path);
+
+    if (descriptor == -1)
+    {
+        throw FileOperationException(probeOpenError);
+    }
+
+    size_t size{ 0 };
+
+    // A single read normally fills the buffer, but a read is allowed to 
+    // return less than requested, so keep going until the end of the file.
+    while (size < sizeof(buffer))
+    {
+        const long count = ReadDescriptor(descriptor, 
+                                          buffer + size, 
+                                          sizeof(buffer) - size);
+
+        if (count < 0)
+        {
+            CloseDescriptor(descriptor);
+            throw FileOperationException(probeReadError);
+        }
+
+        if (count == 0)
+        {
+            break;
+        }
+
+        size += static_cast<size_t>(count);
+    }
+
+    CloseDescriptor(descriptor);
+    return Probe(ByteView{ buffer, size });
+}
+
+ByteView File::TagView() const
+{
+    if (mapping != nullptr)
+    {
+        return mapping->View().Subview(Id666::tagOffset, Id666::tagSize);
+    }
+
+    const std::shared_ptr<const Binary::BufferStream> fieldData =
+        std::as_const(tag).FieldData();
+    return ByteView{ fieldData->RawData(), fieldData->Size() };
+}
+
+bool File::IsModified() const
+{
+    if (!isSynced)
+    {
+        return true;
+    }
+
+    if (headerChanged || changedRamPages.any() || dspRegistersChanged ||
+        unusedChanged || extraRamChanged)
+    {
+        return true;
+    }
+
+    const std::shared_ptr<const Binary::BufferStream> fieldData =
+        std::as_const(tag).FieldData();
+
+    return std::memcmp(fieldData->RawData(), 
+                       savedTag.RawData(), 
+                       savedTag.Size()) != 0 ||
+           SerializeExtendedData() != savedExtendedData;
+}
+
+void File::SetHeader(const Spc::Header& h)
+{
+    header = h;
+    headerChanged = true;
+}
+
+void File::SetHeader(Spc::Header&& h)
+{
+    header = std::move(h);
+    headerChanged = true;
+}
+
+void File::SetRam(const Binary::BufferStream& r)
+{
+    Unmap();
+    MarkChangedRamPages(r);
+    ram = r;
+    loadedSections.set(ramIndex);
+}
+
+void File::SetRam(Binary::BufferStream&& r)
+{
+    Unmap();
+    MarkChangedRamPages(r);
+    ram = std::move(r);
+    loadedSections.set(ramIndex);
+}
+
+void File::SetDspRegisters(const Binary::BufferStream& d)
+{
+    Unmap();
+    dspRegistersChanged = dspRegistersChanged || 
+        SectionChanges(dspRegisters, d, dspRegistersIndex);
+    dspRegisters = d;
+    loadedSections.set(dspRegistersIndex);
+}
+
+void File::SetDspRegisters(Binary::BufferStream&& d)
+{
+    Unmap();
+    dspRegistersChanged = dspRegistersChanged || 
+        SectionChanges(dspRegisters, d, dspRegistersIndex);
+    dspRegisters = std::move(d);
+    loadedSections.set(dspRegistersIndex);
+}
+
+void File::SetUnused(const Binary::BufferStream& u)
+{
+    Unmap();
+    unusedChanged = unusedChanged || 
+        SectionChanges(unused, u, unusedIndex);
+    unused = u;
+    loadedSections.set(unusedIndex);
+}
+
+void File::SetUnused(Binary::BufferStream&& u)
+{
+    Unmap();
+    unusedChanged = unusedChanged || 
+        SectionChanges(unused, u, unusedIndex);
+    unused = std::move(u);
+    loadedSections.set(unusedIndex);
+}
+
+void File::SetExtraRam(const Binary::BufferStream& e)
+{
+    Unmap();
+    extraRamChanged = extraRamChanged || 
+        SectionChanges(extraRam, e, extraRamIndex);
+    extraRam = e;
+    loadedSections.set(extraRamIndex);
+}
+
+void File::SetExtraRam(Binary::BufferStream&& e)
+{
+    Unmap();
+    extraRamChanged = extraRamChanged || 
+        SectionChanges(extraRam, e, extraRamIndex);
+    extraRam = std::move(e);
+    loadedSections.set(extraRamIndex);
+}
+
+void File::PatchRam(size_t offset, ByteView bytes)
+{
+    // Writing whole pages back would overwrite the parts of the page that 
+    // were never read with zeros.
+    if (!loadedSections.test(ramIndex))
+    {
+        throw FileOperationException(sectionsNotLoadedError);
+    }
+
+    if (offset > ram.Size() || bytes.Size() > ram.Size() - offset)
+    {
+        throw std::out_of_range("Patch exceeds the RAM dump.");
+    }
+
+    if (bytes.Empty())
+    {
+        return;
+    }
+
+    Unmap();
+    std::memcpy(ram.RawData() + offset, bytes.Data(), bytes.Size());
+
+    const size_t lastPage = (offset + bytes.Size() - 1) / ramPageSize;
+
+    for (size_t page = offset / ramPageSize; page <= lastPage; page++)
+    {
+        changedRamPages.set(page);
+    }
+}
+
+void File::PatchDspRegisters(size_t offset, ByteView bytes)
+{
+    if (!loadedSections.test(dspRegistersIndex))
+    {
+        throw FileOperationException(sectionsNotLoadedError);
+    }
+
+    if (offset > dspRegisters.Size() || 
+        bytes.Size() > dspRegisters.Size() - offset)
+    {
+        throw std::out_of_range("Patch exceeds the DSP registers.");
+    }
+
+    if (bytes.Empty())
+    {
+        return;
+    }
+
+    Unmap();
+    std::memcpy(dspRegisters.RawData() + offset, bytes.Data(), bytes.Size());
+    dspRegistersChanged = true;
 }
 
-void File::Load()
+void File::Load(LoadMode mode)
+{
+    // If loading fails part way through, what is on disk is no longer known.
+    isSynced = false;
+
+    switch (mode)
+    {
+        case LoadMode::Mapped:
+            LoadMapped();
+            break;
+        case LoadMode::Metadata:
+            LoadMetadata();
+            break;
+        case LoadMode::Buffered:
+            LoadBuffered();
+            break;
+        case LoadMode::Stream:
+            LoadStream();
+            break;
+    }
+
+    MarkSynced();
+}
+
+void File::Load(ByteView bytes)
+{
+    isSynced = false;
+    mapping = nullptr;
+
+    if (bytes.Size() < extraRamInfo.offset + extraRamInfo.size)
+    {
+        throw FileCorruptException(truncatedFileError);
+    }
+
+    ParseMetadata(bytes);
+    CopySections(bytes);
+    loadedSections.set();
+}
+
+const Binary::BufferStream& File::Section(
+    const Binary::BufferStream& buffer,
+    SectionIndex index) const
+{
+    if (!loadedSections.test(index))
+    {
+        throw FileOperationException(sectionsNotLoadedError);
+    }
+
+    if (mapping != nullptr)
+    {
+        sectionsCopy.Call([this] { CopySections(mapping->View()); });
+    }
+
+    return buffer;
+}
+
+ByteView File::SectionView(const Binary::BufferStream& buffer,
+                           FieldInfo info,
+                           SectionIndex index) const
+{
+    if (!loadedSections.test(index))
+    {
+        throw FileOperationException(sectionsNotLoadedError);
+    }
+
+    if (mapping == nullptr)
+    {
+        return ByteView{ buffer.RawData(), buffer.Size() };
+    }
+
+    return mapping->View().Subview(info);
+}
+
+void File::Unmap()
+{
+    if (mapping == nullptr)
+    {
+        return;
+    }
+
+    sectionsCopy.Call([this] { CopySections(mapping->View()); });
+    mapping = nullptr;
+}
+
+void File::CopySections(ByteView bytes) const
+{
+    std::memcpy(ram.RawData(), bytes.Subview(ramInfo).Data(), ram.Size());
+    std::memcpy(dspRegisters.RawData(), 
+                bytes.Subview(dspRegistersInfo).Data(), 
+                dspRegisters.Size());
+    std::memcpy(unused.RawData(), 
+                bytes.Subview(unusedInfo).Data(), 
+                unused.Size());
+    std::memcpy(extraRam.RawData(), 
+                bytes.Subview(extraRamInfo).Data(), 
+                extraRam.Size());
+}
+
+void File::LoadStream()
 {
     if (fileStream == nullptr)
     {
         throw FileOperationException(nullStreamError);
     }
 
+    // Any previous mapping is released up front so the loaded sections are
+    // never mixed with views of a file that may have changed since.
+    mapping = nullptr;
     fileStream->Open(Binary::FileMode::Read);
 
     if (!fileStream->IsOpen())
@@ -94,74 +730,353 @@ void File::Load()
         fileStream->Read(dspRegisters);
         fileStream->Read(unused);
         fileStream->Read(extraRam);
+        LoadExtendedData(*fileStream);
+        fileStream->Close();
+        loadedSections.set();
+    }
+    catch (...)
+    {
+        TryCloseStream(fileStream.get());
+        throw;
+    }
+}
+
+void File::LoadMapped()
+{
+    mapping = nullptr;
+    auto mappedFile = std::make_shared<MappedFile>(path);
+    ByteView bytes = mappedFile->View();
+
+    if (bytes.Size() < extraRamInfo.offset + extraRamInfo.size)
+    {
+        throw FileCorruptException(truncatedFileError);
+    }
+
+    ParseMetadata(bytes);
+    mapping = mappedFile;
+    sectionsCopy.Reset();
+    loadedSections.set();
+}
+
+void File::LoadBuffered()
+{
+    if (fileStream == nullptr)
+    {
+        throw FileOperationException(nullStreamError);
+    }
+
+    mapping = nullptr;
+    fileStream->Open(Binary::FileMode::Read);
+
+    if (!fileStream->IsOpen())
+    {
+        throw FileOperationException(unopenedFileError);
+    }
 
-        std::shared_ptr<Binary::ChunkHeader> extendedHeader =
-            fileStream->FindNextChunk(Id666::Extended::chunkId);
+    std::unique_ptr<Binary::BufferStream> buffer;
 
-        if (extendedHeader != nullptr)
+    try
+    {
+        const size_t fileSize = fileStream->FileSize();
+
+        if (fileSize < extraRamInfo.offset + extraRamInfo.size)
         {
-            // The value of the chunk's dataSize field is the size of all items
-            // (sub-chunks) contained within the chunk, minus the size of the
-            // chunk header itself.
-            size_t sizeRemaining = extendedHeader->dataSize.Value();
+            throw FileCorruptException(truncatedFileError);
+        }
 
-            // When sizeRemaining is less than the minimum size of an item
-            // (the header), we know we're done reading items from the chunk,
-            // but until then, keep reading items from the chunk.
-            while (sizeRemaining >= Id666::Extended::itemHeaderSize)
-            {
-                auto item = std::make_shared<Spc::Id666::Extended::Item>();
-                fileStream->Read(*item);
-
-                const size_t itemSize = item->Size();
-
-                // If the item size exceeds the remaining size of the chunk,
-                // then we know the file is corrupt because the last item's
-                // size should fit within the remaining size.
-                if (itemSize > sizeRemaining)
-                {
-                    throw FileCorruptException(extSizeError);
-                }
-
-                sizeRemaining -= itemSize;
-
-                const uint32_t type = item->type->ToUInt32();
-
-                if (type == Spc::Id666::Extended::stringType)
-                {
-                    LoadStringItem(item, sizeRemaining);
-                }
-                else if (type == Spc::Id666::Extended::lengthType)
-                {
-                    LoadLengthItem(item);
-                }
-                else if (type == Spc::Id666::Extended::integerType)
-                {
-                    LoadIntegerItem(item, sizeRemaining);
-                }
-                else
-                {
-                    throw FileCorruptException(invalidTypeError);
-                }
-            }
+        buffer = std::make_unique<Binary::BufferStream>(fileSize);
+        fileStream->Read(*buffer);
+        fileStream->Close();
+    }
+    catch (...)
+    {
+        TryCloseStream(fileStream.get());
+        throw;
+    }
+
+    ByteView bytes{ buffer->RawData(), buffer->Size() };
+    ParseMetadata(bytes);
+    CopySections(bytes);
+    loadedSections.set();
+}
+
+void File::LoadMetadata()
+{
+    if (fileStream == nullptr)
+    {
+        throw FileOperationException(nullStreamError);
+    }
+
+    mapping = nullptr;
+    fileStream->Open(Binary::FileMode::Read);
+
+    if (!fileStream->IsOpen())
+    {
+        throw FileOperationException(unopenedFileError);
+    }
+
+    try
+    {
+        // Every SPC file is at least large enough to hold the sections that
+        // precede the extended data, even when it has no extended data.
+        if (fileStream->FileSize() < Id666::Extended::dataOffset)
+        {
+            throw FileCorruptException(truncatedFileError);
         }
 
+        fileStream->Read(header);
+        fileStream->Read(*tag.FieldData());
+        fileStream->SetPosition(Id666::Extended::dataOffset);
+        LoadExtendedData(*fileStream);
         fileStream->Close();
+        loadedSections.reset();
     }
     catch (...)
     {
-        TryCloseStream(fileStream.get());
-        throw;
+        TryCloseStream(fileStream.get());
+        throw;
+    }
+}
+
+void File::LoadExtendedData(const Binary::Stream& stream)
+{
+    // Items from a previous load must not survive a reload of a file that no
+    // longer has extended data, or whose chunk cannot be read.
+    tag.SetExtendedItems({});
+    std::shared_ptr<Binary::ChunkHeader> extendedHeader =
+        stream.FindNextChunk(Id666::Extended::chunkId);
+
+    if (extendedHeader != nullptr)
+    {
+        // The value of the chunk's dataSize field is the size of all items
+        // (sub-chunks) contained within the chunk, minus the size of the
+        // chunk header itself. The items are read with one read, but never
+        // more than the file holds in case the size is corrupt.
+        const size_t chunkSize = extendedHeader->dataSize.Value();
+        const size_t position = stream.Position();
+        const size_t end = stream.End();
+        const size_t available = end > position ? end - position : 0;
+
+        Binary::BufferStream chunk{ std::min(chunkSize, available) };
+        stream.Read(chunk);
+
+        Id666::Extended::ItemParser parser{ 
+            ByteView{ chunk.RawData(), chunk.Size() }, chunkSize };
+        tag.SetExtendedItems(parser.ParseAll());
+    }
+}
+
+void File::Save()
+{
+    if (isSynced)
+    {
+        SaveChanges();
+    }
+    else
+    {
+        SaveAll();
+    }
+}
+
+size_t File::SerializedSize() const
+{
+    return Id666::Extended::dataOffset + tag.ExtendedItems().ChunkSize();
+}
+
+void File::Save(std::vector<char>& buffer) const
+{
+    if (!HasSections())
+    {
+        throw FileOperationException(sectionsNotLoadedError);
+    }
+
+    buffer.resize(SerializedSize());
+    Save(buffer.data(), buffer.size());
+}
+
+size_t File::Save(char* buffer, size_t size) const
+{
+    // The sections that were never read would be written out as zeros, 
+    // which would not be the file at all.
+    if (!HasSections())
+    {
+        throw FileOperationException(sectionsNotLoadedError);
+    }
+
+    const std::vector<char> extendedBytes = SerializeExtendedData();
+    const size_t fileSize = Id666::Extended::dataOffset + extendedBytes.size();
+
+    if (size < fileSize)
+    {
+        throw std::out_of_range(bufferSizeError);
+    }
+
+    // The header and tag are serialized through a stream so each field is
+    // written the same way it would be to disk.
+    Binary::BufferStream metadata{ ramInfo.offset };
+    metadata.Write(header);
+    metadata.Write(*std::as_const(tag).FieldData());
+    std::memcpy(buffer, metadata.RawData(), metadata.Size());
+
+    auto copySection = [this, buffer](const Binary::BufferStream& section, 
+                                      FieldInfo info,
+                                      SectionIndex index)
+    {
+        ByteView source = SectionView(section, info, index);
+        std::memcpy(buffer + info.offset, source.Data(), source.Size());
+    };
+
+    copySection(ram, ramInfo, ramIndex);
+    copySection(dspRegisters, dspRegistersInfo, dspRegistersIndex);
+    copySection(unused, unusedInfo, unusedIndex);
+    copySection(extraRam, extraRamInfo, extraRamIndex);
+
+    if (!extendedBytes.empty())
+    {
+        std::memcpy(buffer + Id666::Extended::dataOffset, 
+                    extendedBytes.data(), 
+                    extendedBytes.size());
+    }
+
+    return fileSize;
+}
+
+void File::SaveTag()
+{
+    if (fileStream == nullptr)
+    {
+        throw FileOperationException(nullStreamError);
+    }
+
+    // Not every platform can resize a file while it is mapped.
+    Unmap();
+    fileStream->Open(Binary::FileMode::ReadWrite);
+
+    if (!fileStream->IsOpen())
+    {
+        throw FileOperationException(unopenedFileError);
+    }
+
+    size_t originalSize{ 0 };
+    size_t patchedSize{ Id666::Extended::dataOffset };
+
+    try
+    {
+        originalSize = fileStream->FileSize();
+
+        // Patching a file that does not contain the sections preceding the
+        // extended data would leave a hole where they should be.
+        if (originalSize < Id666::Extended::dataOffset)
+        {
+            throw FileCorruptException(truncatedFileError);
+        }
+
+        fileStream->SetPosition(Id666::tagOffset);
+        fileStream->Write(*std::as_const(tag).FieldData());
+        fileStream->SetPosition(Id666::Extended::dataOffset);
+
+        const std::vector<char> extendedBytes = SerializeExtendedData();
+        WriteExtendedData(extendedBytes);
+        patchedSize += extendedBytes.size();
+        ClearTail(originalSize, patchedSize);
+
+        fileStream->Close();
+    }
+    catch (...)
+    {
+        TryCloseStream(fileStream.get());
+        throw;
+    }
+
+    TruncateFile(originalSize, patchedSize);
+    SnapshotTag();
+}
+
+void File::MarkChangedRamPages(const Binary::BufferStream& r)
+{
+    if (!loadedSections.test(ramIndex) || r.Size() != ram.Size())
+    {
+        changedRamPages.set();
+        return;
+    }
+
+    for (size_t page = 0; page < ramPageCount; page++)
+    {
+        const size_t offset = page * ramPageSize;
+
+        if (std::memcmp(ram.RawData() + offset, 
+                        r.RawData() + offset, 
+                        ramPageSize) != 0)
+        {
+            changedRamPages.set(page);
+        }
+    }
+}
+
+bool File::SectionChanges(const Binary::BufferStream& current,
+                          const Binary::BufferStream& replacement,
+                          SectionIndex index) const
+{
+    // When the section was never loaded, what is on disk is unknown, so it
+    // has to be written regardless of what the buffer holds.
+    return !loadedSections.test(index) || 
+           current.Size() != replacement.Size() ||
+           std::memcmp(current.RawData(), 
+                       replacement.RawData(), 
+                       current.Size()) != 0;
+}
+
+std::vector<char> File::SerializeExtendedData() const
+{
+    const Id666::Extended::ItemTable items = tag.ExtendedItems();
+    std::vector<char> bytes(items.ChunkSize());
+    items.WriteChunk(bytes.data());
+    return bytes;
+}
+
+void File::WriteExtendedData(const std::vector<char>& bytes)
+{
+    if (bytes.empty())
+    {
+        return;
     }
+
+    // The whole chunk goes out in a single write rather than one write for
+    // the chunk header and one for each field of every item.
+    Binary::BufferStream chunk{ bytes.size() };
+    std::memcpy(chunk.RawData(), bytes.data(), bytes.size());
+    fileStream->Write(chunk);
 }
 
-void File::Save()
+void File::SnapshotTag()
+{
+    const std::shared_ptr<const Binary::BufferStream> fieldData =
+        std::as_const(tag).FieldData();
+    std::memcpy(savedTag.RawData(), fieldData->RawData(), savedTag.Size());
+    savedExtendedData = SerializeExtendedData();
+}
+
+void File::MarkSynced()
+{
+    isSynced = true;
+    headerChanged = false;
+    changedRamPages.reset();
+    dspRegistersChanged = false;
+    unusedChanged = false;
+    extraRamChanged = false;
+    SnapshotTag();
+}
+
+void File::SaveAll()
 {
     if (fileStream == nullptr)
     {
         throw FileOperationException(nullStreamError);
     }
 
+    // Opening the file for writing truncates it, so anything still viewed
+    // through the mapping has to be copied out first.
+    Unmap();
     fileStream->Open(Binary::FileMode::Write);
 
     if (!fileStream->IsOpen())
@@ -172,20 +1087,13 @@ void File::Save()
     try
     {
         fileStream->Write(header);
-        fileStream->Write(*tag.FieldData());
+        fileStream->Write(*std::as_const(tag).FieldData());
         fileStream->Write(ram);
         fileStream->Write(dspRegisters);
         fileStream->Write(unused);
         fileStream->Write(extraRam);
 
-        std::shared_ptr<Id666::Extended::Data> extendedData = tag.ExtendedData();
-
-        if (extendedData->Size() > 0)
-        {
-            Binary::ChunkHeader extendedHeader = extendedData->Header();
-            fileStream->Write(extendedHeader);
-            fileStream->Write(*extendedData);
-        }
+        WriteExtendedData(SerializeExtendedData());
 
         fileStream->Close();
     }
@@ -194,569 +1102,350 @@ void File::Save()
         TryCloseStream(fileStream.get());
         throw;
     }
+
+    loadedSections.set();
+    MarkSynced();
 }
 
-void File::LoadStringItem(std::shared_ptr<Id666::Extended::Item> item, 
-                          size_t& sizeRemaining)
+void File::SaveChanges()
 {
-    const size_t itemDataSize = item->data->ToUInt32();
-                
-    // The data size should not exceed the remaining size of the
-    // chunk.
-    if (itemDataSize > sizeRemaining)
+    if (fileStream == nullptr)
     {
-        throw FileCorruptException(extSizeError);
+        throw FileOperationException(nullStreamError);
     }
 
-    Spc::FieldInfo itemDataInfo
+    const std::shared_ptr<const Binary::BufferStream> fieldData =
+        std::as_const(tag).FieldData();
+    const bool tagChanged = std::memcmp(fieldData->RawData(), 
+                                        savedTag.RawData(), 
+                                        savedTag.Size()) != 0;
+    const std::vector<char> extendedBytes = SerializeExtendedData();
+    const bool extendedDataChanged = extendedBytes != savedExtendedData;
+
+    if (!headerChanged && !tagChanged && changedRamPages.none() &&
+        !dspRegistersChanged && !unusedChanged && !extraRamChanged && 
+        !extendedDataChanged)
     {
-        Spc::Id666::Extended::dataOffset, itemDataSize 
-    };
-    item->extendedData = std::make_shared<Spc::TextField>("Extended Data",
-                                                          itemDataInfo);
-    fileStream->Read(*item->extendedData);
-    sizeRemaining -= itemDataSize;
-    LoadPadding(item, sizeRemaining);
-
-    switch (item->id->ToUInt32())
-    {
-        case Spc::Id666::Extended::songTitleInfo.id:
-            tag.ExtendedData()->songTitle = item;
-            break;
-        case Spc::Id666::Extended::gameTitleInfo.id:
-            tag.ExtendedData()->gameTitle = item;
-            break;
-        case Spc::Id666::Extended::songArtistInfo.id:
-            tag.ExtendedData()->songArtist = item;
-            break;
-        case Spc::Id666::Extended::dumperNameInfo.id:
-            tag.ExtendedData()->dumperName = item;
-            break;
-        case Spc::Id666::Extended::commentsInfo.id:
-            tag.ExtendedData()->comments = item;
-            break;
-        case Spc::Id666::Extended::ostTitleInfo.id:
-            tag.ExtendedData()->ostTitle = item;
-            break;
-        case Spc::Id666::Extended::publisherNameInfo.id:
-            tag.ExtendedData()->publisherName = item;
-            break;
-        default:
-            throw FileCorruptException(invalidIdError);
+        return;
     }
-}
-
-void File::LoadPadding(std::shared_ptr<Id666::Extended::Item> item, 
-                       size_t& sizeRemaining)
-{
-
-    const size_t itemDataSize = item->data->ToUInt32();
 
-    // Calculate the number of padding bytes needed to align the data on a 
-    // 4-byte boundary. If itemDataSize is already a multiple of 4, no padding 
-    // is needed (result is 0). Otherwise, subtract the remainder from 4 to get 
-    // the required padding. The final % 4 ensures that if itemDataSize % 4 == 0
-    // the result is 0, not 4.
-    const size_t paddingSize = (4 - (itemDataSize % 4)) % 4;
+    // Not every platform can resize a file while it is mapped.
+    Unmap();
+    fileStream->Open(Binary::FileMode::ReadWrite);
 
-    if (paddingSize > 0)
+    if (!fileStream->IsOpen())
     {
-        if (paddingSize > sizeRemaining)
-        {
-            throw FileCorruptException(extSizeError);
-        }
-
-        Spc::FieldInfo paddingInfo{ Spc::Id666::Extended::dataOffset,
-                                    paddingSize };
-        item->padding = std::make_shared<Spc::TextField>("Padding",
-                                                         paddingInfo);
-        fileStream->Read(*item->padding);
-        sizeRemaining -= paddingSize;
+        throw FileOperationException(unopenedFileError);
     }
-}
 
-void File::LoadLengthItem(std::shared_ptr<Id666::Extended::Item> item)
-{
-    switch (item->id->ToUInt32())
+    size_t originalSize{ 0 };
+
+    try
     {
-        case Spc::Id666::Extended::emulatorUsedInfo.id:
-            tag.ExtendedData()->emulatorUsed = item;
-            break;
-        case Spc::Id666::Extended::ostDiscInfo.id:
-            tag.ExtendedData()->ostDisc = item;
-            break;
-        case Spc::Id666::Extended::ostTrackInfo.id:
-            tag.ExtendedData()->ostTrack = item;
-            break;
-        case Spc::Id666::Extended::copyrightYearInfo.id:
-            tag.ExtendedData()->copyrightYear = item;
-            break;
-        case Spc::Id666::Extended::mutedVoicesInfo.id:
-            tag.ExtendedData()->mutedVoices = item;
-            break;
-        case Spc::Id666::Extended::loopTimesInfo.id:
-            tag.ExtendedData()->loopTimes = item;
-            break;
-        default:
-            throw FileCorruptException(invalidIdError);
-    }
-}
+        originalSize = fileStream->FileSize();
 
-void File::LoadIntegerItem(std::shared_ptr<Id666::Extended::Item> item, 
-                           size_t& sizeRemaining)
-{
-    constexpr uint8_t integerSize{ 4 };
+        // A file too short to hold every section cannot be patched in place
+        // without leaving a hole, so it is written out in full instead.
+        if (originalSize < Id666::Extended::dataOffset)
+        {
+            if (!HasSections())
+            {
+                throw FileCorruptException(truncatedFileError);
+            }
 
-    if (sizeRemaining < integerSize)
-    {
-        throw FileCorruptException(extSizeError);
-    }
+            fileStream->Close();
+            SaveAll();
+            return;
+        }
 
-    auto extendedData = std::make_shared<NumericField>(
-        "Extended Data", 
-        Spc::FieldInfo{ Spc::Id666::Extended::dataOffset, integerSize },
-        Spc::NumericType::Binary);
-    fileStream->Read(*extendedData);
-    item->extendedData = extendedData;
-    sizeRemaining -= integerSize;
+        if (headerChanged)
+        {
+            fileStream->SetPosition(0);
+            fileStream->Write(header);
+        }
 
-    switch (item->id->ToUInt32())
-    {
-        case Spc::Id666::Extended::dateDumpedInfo.id:
-            tag.ExtendedData()->dateDumped = item;
-            break;
-        case Spc::Id666::Extended::introLengthInfo.id:
-            tag.ExtendedData()->introLength = item;
-            break;
-        case Spc::Id666::Extended::loopLengthInfo.id:
-            tag.ExtendedData()->loopLength = item;
-            break;
-        case Spc::Id666::Extended::endLengthInfo.id:
-            tag.ExtendedData()->endLength = item;
-            break;
-        case Spc::Id666::Extended::fadeLengthInfo.id:
-            tag.ExtendedData()->fadeLength = item;
-            break;
-        case Spc::Id666::Extended::preampLevelInfo.id:
-            tag.ExtendedData()->preampLevel = item;
-            break;
-        default:
-            throw FileCorruptException(invalidIdError);
-    }
-}
+        if (tagChanged)
+        {
+            fileStream->SetPosition(Id666::tagOffset);
+            fileStream->Write(*fieldData);
+        }
 
-bool File::TagToFileName(const std::string& pattern)
-{
-    std::vector<Id666::Pattern::Node> nodes = ParsePattern(pattern);
-    std::stringstream stream;
+        WriteChangedRamPages();
 
-    for (Id666::Pattern::Node node : nodes)
-    {
-        switch (node.type)
+        if (dspRegistersChanged)
         {
-            case Id666::Pattern::NodeType::Literal:
-                stream << node.lexeme;
-                break;
-            case Id666::Pattern::NodeType::TextPlaceholder:
-                if (node.lexeme == Id666::Pattern::songPlaceholder)
-                {
-                    stream << tag.SongTitle().Value();
-                }
-                else if (node.lexeme == Id666::Pattern::artistPlaceholder)
-                {
-                    stream << tag.SongArtist().Value();
-                }
-                else if (node.lexeme == Id666::Pattern::gamePlaceholder)
-                {
-                    stream << tag.GameTitle().Value();
-                }
-                else
-                {
-                    return false;
-                }
+            fileStream->SetPosition(dspRegistersInfo.offset);
+            fileStream->Write(dspRegisters);
+        }
 
-                break;
-            case Id666::Pattern::NodeType::NumericPlaceholder:
-                if (node.lexeme == Id666::Pattern::discPlaceholder)
-                {
-                    stream << tag.OstDisc().Value();
-                }
-                else if (node.lexeme == Id666::Pattern::trackPlaceholder)
-                {
-                    stream << tag.OstTrack().Value();
-                }
-                else
-                {
-                    return false;
-                }
-                
-                break;
-            case Id666::Pattern::NodeType::End:
-                break;
+        if (unusedChanged)
+        {
+            fileStream->SetPosition(unusedInfo.offset);
+            fileStream->Write(unused);
         }
-    }
 
-    std::filesystem::path sourcePath(path);
-    std::filesystem::path destinationPath(sourcePath);
-    std::string fileName = stream.str();
+        if (extraRamChanged)
+        {
+            fileStream->SetPosition(extraRamInfo.offset);
+            fileStream->Write(extraRam);
+        }
 
-    if (!IsSafeFileName(fileName))
+        if (extendedDataChanged)
+        {
+            fileStream->SetPosition(Id666::Extended::dataOffset);
+            WriteExtendedData(extendedBytes);
+            ClearTail(originalSize, 
+                      Id666::Extended::dataOffset + extendedBytes.size());
+        }
+
+        fileStream->Close();
+    }
+    catch (...)
     {
-        return false;
+        TryCloseStream(fileStream.get());
+        throw;
     }
 
-    destinationPath.replace_filename(fileName);
-
-    if (sourcePath == destinationPath)
+    if (extendedDataChanged)
     {
-        return false;
+        TruncateFile(originalSize, 
+                     Id666::Extended::dataOffset + extendedBytes.size());
     }
 
-    std::error_code error;
-    const bool copied = std::filesystem::copy_file(
-        sourcePath,
-        destinationPath,
-        std::filesystem::copy_options::none,
-        error);
-
-    return copied && !error;
+    MarkSynced();
 }
 
-bool File::FileNameToTag(const std::string& pattern)
+void File::WriteChangedRamPages()
 {
-    std::vector<Id666::Pattern::Node> nodes = ParsePattern(pattern);
-    std::filesystem::path p(path);
-    std::string filename = p.filename().string();
-    std::stringstream stream{ filename };
-    bool success{ true };
-    std::string songTitle;
-    std::string songArtist;
-    std::string gameTitle;
-    std::string ostDisc;
-    std::string ostTrack;
-    bool hasSongTitle{ false };
-    bool hasSongArtist{ false };
-    bool hasGameTitle{ false };
-    bool hasOstDisc{ false };
-    bool hasOstTrack{ false };
-    
-    for (int i = 0; i < nodes.size(); i++)
-    {
-        Id666::Pattern::Node* nextNode{ nullptr};
-        Id666::Pattern::Node node = nodes[i];
+    size_t page{ 0 };
 
-        if (i + 1 < nodes.size())
+    // Consecutive changed pages are coalesced so each run is a single write.
+    while (page < ramPageCount)
+    {
+        if (!changedRamPages.test(page))
         {
-            nextNode = &nodes[i + 1];
+            page++;
+            continue;
         }
 
-        switch (node.type)
-        {
-            case Id666::Pattern::NodeType::Literal:
-                success = MatchLiteral(stream, node);
-                break;
-            case Id666::Pattern::NodeType::TextPlaceholder:
-            {
-                std::string parsedText;
-                success = MatchText(stream,
-                                    filename,
-                                    node,
-                                    nextNode,
-                                    parsedText);
-
-                if (success)
-                {
-                    if (node.lexeme == Id666::Pattern::songPlaceholder)
-                    {
-                        songTitle = parsedText;
-                        hasSongTitle = true;
-                    }
-                    else if (node.lexeme == Id666::Pattern::artistPlaceholder)
-                    {
-                        songArtist = parsedText;
-                        hasSongArtist = true;
-                    }
-                    else if (node.lexeme == Id666::Pattern::gamePlaceholder)
-                    {
-                        gameTitle = parsedText;
-                        hasGameTitle = true;
-                    }
-                }
-
-                break;
-            }
-            case Id666::Pattern::NodeType::NumericPlaceholder:
-            {
-                std::string parsedNumeric;
-                success = MatchNumeric(stream,
-                                       filename,
-                                       node,
-                                       nextNode,
-                                       parsedNumeric);
-
-                if (success)
-                {
-                    if (node.lexeme == Id666::Pattern::discPlaceholder)
-                    {
-                        ostDisc = parsedNumeric;
-                        hasOstDisc = true;
-                    }
-                    else if (node.lexeme == Id666::Pattern::trackPlaceholder)
-                    {
-                        ostTrack = parsedNumeric;
-                        hasOstTrack = true;
-                    }
-                }
-
-                break;
-            }
-            case Id666::Pattern::NodeType::End:
-                success = MatchEnd(stream);
-                break;
-        }
+        const size_t firstPage = page;
 
-        if (!success)
+        while (page < ramPageCount && changedRamPages.test(page))
         {
-            return false;
+            page++;
         }
-    }
-
-    auto applyParsedValues =
-        [&](Spc::Id666::Tag& targetTag)
-        {
-            if (hasSongTitle)
-            {
-                targetTag.SetSongTitle(songTitle);
-            }
-
-            if (hasSongArtist)
-            {
-                targetTag.SetSongArtist(songArtist);
-            }
-
-            if (hasGameTitle)
-            {
-                targetTag.SetGameTitle(gameTitle);
-            }
-
-            if (hasOstDisc)
-            {
-                targetTag.SetOstDisc(ostDisc);
-            }
 
-            if (hasOstTrack)
-            {
-                targetTag.SetOstTrack(ostTrack);
-            }
-        };
+        const size_t offset = firstPage * ramPageSize;
 
-    try
-    {
-        // Validate first so we don't partially mutate the file's tag.
-        Spc::Id666::Tag validationTag;
-        applyParsedValues(validationTag);
+        if (offset >= ram.Size())
+        {
+            break;
+        }
 
-        applyParsedValues(tag);
-    }
-    catch (const std::invalid_argument&)
-    {
-        return false;
+        const size_t size = std::min((page - firstPage) * ramPageSize, 
+                                     ram.Size() - offset);
+        Binary::RawField run{ size };
+        std::memcpy(run.RawData(), ram.RawData() + offset, size);
+        fileStream->SetPosition(ramInfo.offset + offset);
+        fileStream->Write(run);
     }
-    catch (const std::out_of_range&)
+}
+
+void File::ClearTail(size_t originalSize, size_t newSize)
+{
+    // An injected stream need not be backed by the file at Path(), and 
+    // Binary::FileStream has no way to resize, so the old tail is zeroed 
+    // through the stream instead. That way the next load cannot find a stale
+    // extended data chunk past the new end.
+    if (ownsStream || newSize >= originalSize)
     {
-        return false;
+        return;
     }
 
-    Save();
-
-    return true;
+    Binary::RawField zeros{ originalSize - newSize };
+    std::memset(zeros.RawData(), 0, zeros.Size());
+    fileStream->SetPosition(newSize);
+    fileStream->Write(zeros);
 }
 
-bool File::MatchNumeric(std::stringstream& stream, 
-                        const std::string& fileName,
-                        Id666::Pattern::Node node,
-                        Id666::Pattern::Node* nextNode,
-                        std::string& numericString)
+void File::TruncateFile(size_t originalSize, size_t newSize)
 {
-    if (nextNode == nullptr)
+    // Writing already extended the file if it grew, but if it shrank, the 
+    // tail of the old contents is still there. Only a stream the file 
+    // created itself is known to be backed by Path().
+    if (!ownsStream || newSize >= originalSize)
     {
-        return false;
+        return;
     }
 
-    size_t numericStringSize{ 0 };
-    std::streampos currentPos = stream.tellg();
+    std::error_code error;
+    std::filesystem::resize_file(path, newSize, error);
 
-    if (currentPos == -1)
+    if (error)
     {
-        return false;
+        throw FileOperationException(resizeError);
     }
+}
 
-    const size_t startIndex = static_cast<size_t>(currentPos);
+void File::ParseMetadata(ByteView bytes)
+{
+    CopyFields(header, bytes);
 
-    if (startIndex > fileName.size())
-    {
-        return false;
-    }
+    std::shared_ptr<Binary::BufferStream> fieldData = tag.FieldData();
+    ByteView tagBytes = bytes.Subview(Id666::tagOffset, Id666::tagSize);
+    std::memcpy(fieldData->RawData(), tagBytes.Data(), tagBytes.Size());
+
+    ByteCursor cursor{ bytes };
+    cursor.Seek(Id666::Extended::dataOffset);
+    ParseExtendedData(cursor);
+}
 
-    std::string_view contentView{ fileName };
-    contentView = contentView.substr(startIndex);
+void File::ParseExtendedData(ByteCursor& cursor)
+{
+    tag.SetExtendedItems({});
 
-    if (nextNode->type == Id666::Pattern::NodeType::Literal)
+    // Like Binary::Stream::FindNextChunk(), skip over any chunks that are not
+    // the extended data chunk, and give up if a chunk runs past the end.
+    while (cursor.Remaining() >= chunkHeaderSize)
     {
-        size_t index = contentView.find(nextNode->lexeme);
+        ByteView id = cursor.Read(chunkIdSize);
+        const size_t chunkSize = cursor.ReadUInt32();
 
-        if (index == std::string::npos)
+        if (std::string_view{ id.Data(), id.Size() } != 
+            Id666::Extended::chunkId)
         {
-            return false;
+            if (chunkSize > cursor.Remaining())
+            {
+                return;
+            }
+
+            cursor.Skip(chunkSize);
+            continue;
         }
 
-        numericStringSize = index;
-    }
-    else if (nextNode->type == Id666::Pattern::NodeType::End)
-    {
-        numericStringSize = contentView.size();
-    }
-    else
-    {
-        return false;
+        // The items are copied into a single table rather than one heap
+        // allocated item per field, and are only decoded if they are read.
+        ByteView items = cursor.Read(std::min(chunkSize, cursor.Remaining()));
+        Id666::Extended::ItemParser parser{ items, chunkSize };
+        tag.SetExtendedItems(parser.ParseAll());
+        return;
     }
+}
 
-    if (node.lexeme != Id666::Pattern::discPlaceholder &&
-        node.lexeme != Id666::Pattern::trackPlaceholder)
-    {
-        return false;
-    }
+bool File::TagToFileName(const std::string& pattern, TransferMode mode)
+{
+    return TagToFileName(Id666::Pattern::Compiled{ pattern }, mode);
+}
 
-    numericString.assign(numericStringSize, '\0');
-    stream.read(numericString.data(), numericStringSize);
+bool File::TagToFileName(const Id666::Pattern::Compiled& pattern, 
+                         TransferMode mode)
+{
+    std::string fileName;
 
-    if (stream.gcount() != static_cast<std::streamsize>(numericStringSize))
+    if (!pattern.Format(tag, fileName))
     {
         return false;
     }
 
-    return true;
-}
+    std::filesystem::path sourcePath(path);
+    std::filesystem::path destinationPath(sourcePath);
 
-bool File::MatchText(std::stringstream& stream,
-                     const std::string& fileName,
-                     Id666::Pattern::Node node,
-                     Id666::Pattern::Node* nextNode,
-                     std::string& textString)
-{
-    if (nextNode == nullptr)
+    if (!IsSafeFileName(fileName))
     {
         return false;
     }
 
-    size_t textStringSize{ 0 };
-    std::streampos currentPos = stream.tellg();
+    destinationPath.replace_filename(fileName);
 
-    if (currentPos == -1)
-    {
-        return false;
-    }
+    return TransferTo(destinationPath, mode);
+}
 
-    const size_t startIndex = static_cast<size_t>(currentPos);
+bool File::TagToFileName(Layout& layout, TransferMode mode)
+{
+    std::optional<std::filesystem::path> destinationPath = 
+        layout.Prepare(tag);
 
-    if (startIndex > fileName.size())
+    if (!destinationPath.has_value())
     {
         return false;
     }
 
-    std::string_view contentView{ fileName };
-    contentView = contentView.substr(startIndex);
-
-    if (nextNode->type == Id666::Pattern::NodeType::Literal)
-    {
-        size_t index = contentView.find(nextNode->lexeme);
-
-        if (index == std::string::npos)
-        {
-            return false;
-        }
+    return TransferTo(*destinationPath, mode);
+}
 
-        textStringSize = index;
-    }
-    else if (nextNode->type == Id666::Pattern::NodeType::End)
-    {
-        textStringSize = contentView.size();
-    }
-    else
+bool File::TransferTo(const std::filesystem::path& destinationPath, 
+                      TransferMode mode)
+{
+    // An injected stream can't be pointed at the new path, so the file 
+    // could never be saved again after a move.
+    if (mode == TransferMode::Move && !ownsStream)
     {
         return false;
     }
 
-    if (node.lexeme != Id666::Pattern::songPlaceholder &&
-        node.lexeme != Id666::Pattern::artistPlaceholder &&
-        node.lexeme != Id666::Pattern::gamePlaceholder)
+    if (!Transfer(std::filesystem::path{ path }, destinationPath, mode))
     {
         return false;
     }
 
-    textString.assign(textStringSize, '\0');
-    stream.read(textString.data(), textStringSize);
-
-    if (stream.gcount() != static_cast<std::streamsize>(textStringSize))
+    if (mode == TransferMode::Move)
     {
-        return false;
+        path = destinationPath.string();
+        fileStream = std::make_shared<Binary::StandardFileStream>(path);
     }
 
     return true;
 }
 
-bool Spc::MatchEnd(std::stringstream& stream)
+bool File::FileNameToTag(const std::string& pattern)
 {
-    if (stream.tellg() == -1 || 
-        stream.tellg() == static_cast<std::streampos>(stream.str().size()))
-    {
-        return true;
-    }
-    else
-    {
-        return false;
-    }
+    return FileNameToTag(Id666::Pattern::Compiled{ pattern });
 }
 
-bool Spc::MatchLiteral(std::stringstream& stream, Id666::Pattern::Node node)
+bool File::FileNameToTag(const Id666::Pattern::Compiled& pattern)
 {
-    if (node.type != Id666::Pattern::NodeType::Literal)
+    std::filesystem::path p(path);
+    const std::string filename = p.filename().string();
+    const std::optional<std::vector<Id666::Pattern::Capture>> captures = 
+        pattern.Match(filename);
+
+    if (!captures.has_value())
     {
         return false;
     }
-    else
-    {
-        std::streampos currentPos = stream.tellg();
-        size_t remaining{ 0 };
-
-        if (currentPos == -1)
-        {
-            return false;
-        }
-        else
-        {
-            remaining = stream.str().size() - static_cast<size_t>(currentPos);
-        }
 
-        if (remaining < node.lexeme.size())
-        {
-            return false;
-        }
-        else
+    auto applyParsedValues =
+        [&](Spc::Id666::Tag& targetTag)
         {
-            std::string literalString(node.lexeme.size(), '\0');
-            stream.read(literalString.data(), node.lexeme.size());
-
-            if (literalString == node.lexeme)
+            for (const Id666::Pattern::Capture& capture : *captures)
             {
-                return true;
+                targetTag.SetFieldValue(
+                    *capture.field, 
+                    Id666::Pattern::FileNameToTagValue(*capture.field, 
+                                                       capture.value));
             }
-            else
-            {
-                return false;
-            }
-        }
+        };
+
+    try
+    {
+        // Validate first so we don't partially mutate the file's tag.
+        Spc::Id666::Tag validationTag;
+        applyParsedValues(validationTag);
+
+        applyParsedValues(tag);
+    }
+    catch (const std::invalid_argument&)
+    {
+        return false;
     }
+    catch (const std::out_of_range&)
+    {
+        return false;
+    }
+
+    Save();
+
+    return true;
 }
 
 std::vector<Id666::Pattern::Node> Spc::ParsePattern(std::string_view pattern)
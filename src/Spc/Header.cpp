@@ -20,17 +20,27 @@ using namespace Spc;
 
 Header::Header()
 {
-    spcFields.push_back(&id);
-    spcFields.push_back(&separator);
-    spcFields.push_back(&containsTag);
-    spcFields.push_back(&versionMinor);
-    spcFields.push_back(&pcRegister);
-    spcFields.push_back(&aRegister);
-    spcFields.push_back(&xRegister);
-    spcFields.push_back(&yRegister);
-    spcFields.push_back(&pswRegister);
-    spcFields.push_back(&spRegister);
-    spcFields.push_back(&reserved);
+    std::apply([this](auto... members)
+               {
+                   (spcFields.push_back(&(this->*members)), ...);
+               },
+               Members());
+}
+
+Header::Header(const Header& other) : Header()
+{
+    *this = other;
+}
+
+Header& Header::operator=(const Header& other)
+{
+    // Only the fields are copied; spcFields keeps pointing at our own fields.
+    std::apply([this, &other](auto... members)
+               {
+                   ((this->*members = other.*members), ...);
+               },
+               Members());
+    return *this;
 }
 
 bool Header::ContainsTag() const
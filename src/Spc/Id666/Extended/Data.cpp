@@ -31,41 +31,31 @@ Binary::ChunkHeader Data::Header() const
 
 std::vector<Field*> Data::SpcFields() const
 {
-    std::vector<Field*> nonNullFields;
-    std::vector<Item*> items;
+    std::vector<Field*> fields;
 
-    items.push_back(songTitle.get());
-    items.push_back(gameTitle.get());
-    items.push_back(songArtist.get());
-    items.push_back(dumperName.get());
-    items.push_back(dateDumped.get());
-    items.push_back(emulatorUsed.get());
-    items.push_back(comments.get());
-    items.push_back(ostTitle.get());
-    items.push_back(ostDisc.get());
-    items.push_back(ostTrack.get());
-    items.push_back(publisherName.get());
-    items.push_back(copyrightYear.get());
-    items.push_back(introLength.get());
-    items.push_back(loopLength.get());
-    items.push_back(endLength.get());
-    items.push_back(fadeLength.get());
-    items.push_back(mutedVoices.get());
-    items.push_back(loopTimes.get());
-    items.push_back(preampLevel.get());
-
-    for (Item* item : items)
+    for (auto member : Items())
     {
-        if (item != nullptr)
+        if (const Item* item = (this->*member).get())
         {
-            std::vector<Field*> fields = item->SpcFields();
+            std::vector<Field*> itemFields = item->SpcFields();
+            fields.insert(fields.end(), itemFields.begin(), itemFields.end());
+        }
+    }
+
+    return fields;
+}
 
-            for (Field* field : fields)
-            {
-                nonNullFields.push_back(field);
-            }
+size_t Data::Size() const
+{
+    size_t size{ 0 };
+
+    for (auto member : Items())
+    {
+        if (const Item* item = (this->*member).get())
+        {
+            size += item->Size();
         }
     }
 
-    return nonNullFields;
+    return size;
 }
@@ -73,4 +73,21 @@ std::vector<Field*> Item::SpcFields() const
     }
 
     return fields;
+}
+
+size_t Item::Size() const
+{
+    size_t size = id->Size() + type->Size() + data->Size();
+
+    if (extendedData != nullptr && type->ToInt32() != lengthType)
+    {
+        size += extendedData->Size();
+
+        if (padding != nullptr)
+        {
+            size += padding->Size();
+        }
+    }
+
+    return size;
 }
\ No newline at end of file
@@ -0,0 +1,109 @@
+// ItemParser.cpp - Defines the Spc::Id666::Extended::ItemParser class.
+//
+// Copyright (C) 2026 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "Spc/Id666/Extended/ItemParser.h"
+
+#include <algorithm>
+#include "Spc/FileCorruptException.h"
+#include "Spc/Id666/FieldDescriptor.h"
+
+using namespace Spc;
+using namespace Spc::Id666::Extended;
+
+const char* extSizeError{ "Extended item size exceeds remaining chunk size." };
+const char* invalidTypeError{ "Invalid extended item type detected." };
+const char* invalidIdError{ "Invalid extended item ID detected." };
+
+namespace
+{
+    size_t PaddingSize(size_t dataSize)
+    {
+        // Calculate the number of padding bytes needed to align the data on a
+        // 4-byte boundary. If dataSize is already a multiple of 4, no padding
+        // is needed (result is 0). Otherwise, subtract the remainder from 4 to
+        // get the required padding. The final % 4 ensures that if dataSize % 4
+        // == 0 the result is 0, not 4.
+        return (4 - (dataSize % 4)) % 4;
+    }
+}
+
+std::optional<ItemView> ItemParser::Next()
+{
+    // When sizeRemaining is less than the minimum size of an item (the
+    // header), there are no more items in the chunk.
+    if (sizeRemaining < itemHeaderSize)
+    {
+        return std::nullopt;
+    }
+
+    ItemView item;
+    item.id = cursor.ReadUInt8();
+    item.type = cursor.ReadUInt8();
+    item.data = cursor.ReadUInt16();
+    sizeRemaining -= itemHeaderSize;
+
+    size_t payloadSize{ 0 };
+    size_t paddingSize{ 0 };
+
+    if (item.type == stringType)
+    {
+        payloadSize = item.data;
+        paddingSize = PaddingSize(payloadSize);
+    }
+    else if (item.type == integerType)
+    {
+        payloadSize = integerSize;
+    }
+    else if (item.type != lengthType)
+    {
+        throw FileCorruptException(invalidTypeError);
+    }
+
+    // The item's data should fit within the remaining size of the chunk, 
+    // otherwise the file is corrupt.
+    if (payloadSize + paddingSize > sizeRemaining)
+    {
+        throw FileCorruptException(extSizeError);
+    }
+
+    item.payload = cursor.Read(payloadSize);
+    item.padding = cursor.Read(paddingSize);
+    sizeRemaining -= payloadSize + paddingSize;
+
+    // An ID that belongs to an item of another type is as corrupt as an ID
+    // that is not defined at all.
+    const FieldDescriptor* field = FindExtendedField(item.id);
+
+    if (field == nullptr || field->item->type != item.type)
+    {
+        throw FileCorruptException(invalidIdError);
+    }
+
+    return item;
+}
+
+ItemTable ItemParser::ParseAll()
+{
+    ItemTable items;
+    items.Reserve(std::min(sizeRemaining, cursor.Remaining()));
+
+    while (std::optional<ItemView> item = Next())
+    {
+        items.Set(*item);
+    }
+
+    return items;
+}
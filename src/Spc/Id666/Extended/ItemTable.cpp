@@ -0,0 +1,295 @@
+// ItemTable.cpp - Defines the Spc::Id666::Extended::ItemTable class.
+//
+// Copyright (C) 2026 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "Spc/Id666/Extended/ItemTable.h"
+
+#include <algorithm>
+#include <cstring>
+#include "Spc/Id666/FieldDescriptor.h"
+
+using namespace Spc;
+using namespace Spc::Id666::Extended;
+
+namespace
+{
+    // Strings are padded so the next item starts on a 4-byte boundary.
+    size_t PaddingSize(uint8_t type, size_t payloadSize)
+    {
+        return type == stringType ? (4 - payloadSize % 4) % 4 : 0;
+    }
+
+    ByteView RawView(const Field* field)
+    {
+        if (field == nullptr)
+        {
+            return ByteView{};
+        }
+
+        return ByteView{ field->RawData(), field->Size() };
+    }
+
+    uint8_t FirstByte(const Field& field)
+    {
+        return static_cast<uint8_t>(field.RawData()[0]);
+    }
+
+    void Decode(const ItemView& view, Data& data)
+    {
+        const Id666::FieldDescriptor* field = Id666::FindExtendedField(
+            view.id);
+
+        if (field == nullptr)
+        {
+            return;
+        }
+
+        auto item = std::make_shared<Item>();
+        item->id->RawData()[0] = static_cast<char>(view.id);
+        item->type->RawData()[0] = static_cast<char>(view.type);
+        item->data->RawData()[0] = static_cast<char>(view.data & 0xFF);
+        item->data->RawData()[1] = static_cast<char>(view.data >> 8);
+
+        if (view.type == integerType)
+        {
+            item->extendedData = std::make_shared<NumericField>(
+                "Extended Data", 
+                FieldInfo{ dataOffset, view.payload.Size() },
+                NumericType::Binary);
+        }
+        else if (view.type != lengthType)
+        {
+            item->extendedData = std::make_shared<TextField>(
+                "Extended Data", 
+                FieldInfo{ dataOffset, view.payload.Size() });
+        }
+
+        if (item->extendedData != nullptr && !view.payload.Empty())
+        {
+            std::memcpy(item->extendedData->RawData(), 
+                        view.payload.Data(), 
+                        view.payload.Size());
+        }
+
+        if (!view.padding.Empty())
+        {
+            item->padding = std::make_shared<TextField>(
+                "Padding", 
+                FieldInfo{ dataOffset, view.padding.Size() });
+            std::memcpy(item->padding->RawData(), 
+                        view.padding.Data(), 
+                        view.padding.Size());
+        }
+
+        data.*field->member = item;
+    }
+}
+
+ItemView Spc::Id666::Extended::ViewOf(const Item& item)
+{
+    ItemView view;
+    view.id = FirstByte(*item.id);
+    view.type = FirstByte(*item.type);
+    view.data = static_cast<uint16_t>(
+        FirstByte(*item.data) | 
+        static_cast<uint8_t>(item.data->RawData()[1]) << 8);
+
+    if (view.type != lengthType)
+    {
+        view.payload = RawView(item.extendedData.get());
+        view.padding = RawView(item.padding.get());
+    }
+
+    return view;
+}
+
+ItemTable ItemTable::FromData(const Data& data)
+{
+    ItemTable table;
+    table.Reserve(data.Size());
+
+    for (auto member : Data::Items())
+    {
+        const Item* item = (data.*member).get();
+
+        if (item == nullptr)
+        {
+            continue;
+        }
+
+        table.Set(ViewOf(*item));
+    }
+
+    return table;
+}
+
+std::optional<ItemView> ItemTable::Find(uint8_t id) const
+{
+    if (!Contains(id))
+    {
+        return std::nullopt;
+    }
+
+    return ViewAt(id);
+}
+
+void ItemTable::Set(const ItemView& item)
+{
+    uint16_t data = item.data;
+    size_t payloadSize = 0;
+
+    if (item.type == integerType)
+    {
+        payloadSize = integerSize;
+    }
+    else if (item.type != lengthType)
+    {
+        payloadSize = item.payload.Size();
+        data = static_cast<uint16_t>(payloadSize);
+    }
+
+    const size_t paddingSize = PaddingSize(item.type, payloadSize);
+    const size_t size = itemHeaderSize + payloadSize + paddingSize;
+
+    if (!Contains(item.id) || ViewAt(item.id).Size() != size)
+    {
+        Remove(item.id);
+        offsets[item.id] = static_cast<uint32_t>(bytes.size() + 1);
+        bytes.resize(bytes.size() + size);
+        count++;
+    }
+
+    char* destination = bytes.data() + offsets[item.id] - 1;
+    destination[0] = static_cast<char>(item.id);
+    destination[1] = static_cast<char>(item.type);
+    destination[2] = static_cast<char>(data & 0xFF);
+    destination[3] = static_cast<char>(data >> 8);
+    destination += itemHeaderSize;
+
+    // Integer payloads are always 4 bytes, whatever size the item was given.
+    std::fill_n(destination, payloadSize + paddingSize, 0);
+
+    if (!item.payload.Empty())
+    {
+        std::memcpy(destination, 
+                    item.payload.Data(), 
+                    std::min(item.payload.Size(), payloadSize));
+    }
+
+    if (item.padding.Size() == paddingSize && paddingSize > 0)
+    {
+        std::memcpy(destination + payloadSize, 
+                    item.padding.Data(), 
+                    paddingSize);
+    }
+}
+
+void ItemTable::Remove(uint8_t id)
+{
+    if (!Contains(id))
+    {
+        return;
+    }
+
+    const uint32_t offset = offsets[id] - 1;
+    const uint32_t size = static_cast<uint32_t>(ViewAt(id).Size());
+    bytes.erase(bytes.begin() + offset, bytes.begin() + offset + size);
+    offsets[id] = 0;
+    count--;
+
+    for (uint32_t& other : offsets)
+    {
+        if (other > offset)
+        {
+            other -= size;
+        }
+    }
+}
+
+void ItemTable::Clear()
+{
+    bytes.clear();
+    offsets.fill(0);
+    count = 0;
+}
+
+void ItemTable::DecodeInto(Data& data) const
+{
+    for (ItemView view : *this)
+    {
+        Decode(view, data);
+    }
+}
+
+void ItemTable::DecodeInto(Data& data, uint8_t id) const
+{
+    if (Contains(id))
+    {
+        Decode(ViewAt(id), data);
+    }
+}
+
+void ItemTable::WriteChunk(char* destination) const
+{
+    if (Empty())
+    {
+        return;
+    }
+
+    std::memcpy(destination, chunkId, chunkHeaderSize - 4);
+    destination += chunkHeaderSize - 4;
+
+    for (size_t i = 0; i < 4; i++)
+    {
+        *destination++ = static_cast<char>(bytes.size() >> (i * 8));
+    }
+
+    // Each item is already stored in its xid6 layout, so it only has to be
+    // copied to the right place.
+    for (size_t id = 0; id < maxItems; id++)
+    {
+        if (offsets[id] != 0)
+        {
+            const size_t itemSize = ViewAt(id).Size();
+            std::memcpy(destination, bytes.data() + offsets[id] - 1, itemSize);
+            destination += itemSize;
+        }
+    }
+}
+
+ItemView ItemTable::ViewAt(size_t id) const
+{
+    const char* item = bytes.data() + offsets[id] - 1;
+
+    ItemView view;
+    view.id = static_cast<uint8_t>(item[0]);
+    view.type = static_cast<uint8_t>(item[1]);
+    view.data = static_cast<uint16_t>(static_cast<uint8_t>(item[2]) | 
+                                      static_cast<uint8_t>(item[3]) << 8);
+
+    if (view.type == integerType)
+    {
+        view.payload = ByteView{ item + itemHeaderSize, integerSize };
+    }
+    else if (view.type != lengthType)
+    {
+        view.payload = ByteView{ item + itemHeaderSize, view.data };
+    }
+
+    const size_t paddingSize = PaddingSize(view.type, view.payload.Size());
+    view.padding = ByteView{ item + itemHeaderSize + view.payload.Size(), 
+                             paddingSize };
+    return view;
+}
@@ -0,0 +1,363 @@
+// Compiled.cpp - Defines the Spc::Id666::Pattern::Compiled class.
+//
+// Copyright (C) 2026 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "Spc/Id666/Pattern/Compiled.h"
+
+#include <array>
+#include <cstdint>
+#include <utility>
+#include "Spc/Id666/Pattern/Lexer.h"
+#include "Spc/Id666/Pattern/Parser.h"
+#include "Spc/Id666/Pattern/Placeholder.h"
+
+using namespace Spc::Id666;
+using namespace Spc::Id666::Pattern;
+
+namespace
+{
+    bool IsDigit(char c)
+    {
+        return c >= '0' && c <= '9';
+    }
+
+    bool IsLetter(char c)
+    {
+        return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z');
+    }
+
+    // Counts the run of characters that satisfy a test starting at each 
+    // position of the file name, so runs can be looked up in constant time.
+    template <typename Test>
+    std::vector<size_t> Runs(std::string_view fileName, Test test)
+    {
+        std::vector<size_t> runs(fileName.size() + 1, 0);
+
+        for (size_t p = fileName.size(); p-- > 0;)
+        {
+            runs[p] = test(fileName[p]) ? runs[p + 1] + 1 : 0;
+        }
+
+        return runs;
+    }
+
+    // The digits of each part of a date in a file name, as in MM-DD-YYYY.
+    constexpr size_t dateParts[]{ 2, 2, 4 };
+
+    // A date is written with a fixed shape, so it is matched by that shape 
+    // rather than as free text, which would end it at the first separator.
+    bool IsFreeText(const Segment& segment)
+    {
+        return segment.type == NodeType::TextPlaceholder && 
+               segment.field->kind != FieldKind::Date;
+    }
+
+    // Gets the length of the date at a position, or 0 if there is none.
+    size_t DateLength(std::string_view fileName,
+                      const std::vector<size_t>& digits,
+                      size_t position)
+    {
+        size_t end = position;
+
+        for (size_t part : dateParts)
+        {
+            if (end > position)
+            {
+                if (end >= fileName.size() || 
+                    fileName[end] != dateSeparatorChar)
+                {
+                    return 0;
+                }
+
+                end++;
+            }
+
+            if (digits[end] < part)
+            {
+                return 0;
+            }
+
+            end += part;
+        }
+
+        return end - position;
+    }
+
+    // The lengths a placeholder can match at a position: any length from min
+    // to max, plus max + 1 when suffix is set (a track's letter suffix), plus
+    // up to pad more characters of trailing padding after those. When max is
+    // less than min, only the suffix length can match.
+    struct Lengths
+    {
+        size_t min;
+        size_t max;
+        bool suffix;
+        size_t pad;
+
+        size_t End() const { return max + (suffix ? 1 : 0); }
+    };
+
+    Lengths PlaceholderLengths(const Segment& segment,
+                               std::string_view fileName,
+                               const std::vector<size_t>& digits,
+                               const std::vector<size_t>& spaces,
+                               size_t position)
+    {
+        if (IsFreeText(segment))
+        {
+            return Lengths{ 0, fileName.size() - position, false, 0 };
+        }
+
+        // Space padding on the left comes before the digits, and space 
+        // padding on the right comes after them.
+        const bool trimmed = segment.format.IsTrimmed();
+        const size_t lead = trimmed && !segment.format.leftAlign ? 
+                            spaces[position] : 0;
+
+        // A date matches all of its shape or, when it is empty, nothing.
+        if (segment.field->kind == FieldKind::Date)
+        {
+            const size_t date = DateLength(fileName, digits, position + lead);
+            Lengths lengths{ lead + date, lead + date, false, 0 };
+
+            if (trimmed && segment.format.leftAlign)
+            {
+                lengths.pad = spaces[position + lengths.End()];
+            }
+
+            return lengths;
+        }
+
+        // Numbers need at least one digit, and only a track number may be
+        // followed by a letter, such as the "b" in "12b".
+        const size_t run = digits[position + lead];
+        const size_t next = position + lead + run;
+        const bool suffix = segment.field->kind == FieldKind::Track && 
+                            run > 0 && next < fileName.size() && 
+                            IsLetter(fileName[next]);
+
+        Lengths lengths{ lead + 1, lead + run, suffix, 0 };
+
+        if (trimmed && segment.format.leftAlign && run > 0)
+        {
+            lengths.pad = spaces[position + lengths.End()];
+        }
+
+        return lengths;
+    }
+}
+
+Compiled::Compiled(std::string_view pattern) : source{ pattern }, valid{ true }
+{
+    Lexer lexer{ source };
+    std::vector<Token> tokens;
+
+    do
+    {
+        tokens.push_back(lexer.Lex());
+    }
+    while (tokens.back().Type() != TokenType::End);
+
+    Parser parser{ tokens };
+
+    for (const Node& node : parser.Parse())
+    {
+        const FieldDescriptor* field{ nullptr };
+        std::optional<FormatSpec> format{ FormatSpec{ 0, ' ', false } };
+
+        if (node.type == NodeType::TextPlaceholder || 
+            node.type == NodeType::NumericPlaceholder)
+        {
+            if (node.placeholder != nullptr)
+            {
+                field = node.placeholder->field;
+            }
+
+            format = ParseFormat(node.format);
+            valid = valid && field != nullptr && format.has_value();
+        }
+
+        segments.push_back(Segment{ node.type, std::string{ node.lexeme }, 
+                                    field, format.value_or(FormatSpec{ }) });
+    }
+}
+
+std::optional<std::vector<Capture>> Compiled::Match(
+    std::string_view fileName) const
+{
+    if (!valid)
+    {
+        return std::nullopt;
+    }
+
+    const size_t size = fileName.size();
+    const size_t stride = size + 2;
+
+    // digits[p] is the length of the run of digits starting at position p,
+    // and spaces[p] the length of the run of spaces.
+    const std::vector<size_t> digits = Runs(fileName, IsDigit);
+    const std::vector<size_t> spaces = Runs(fileName, 
+                                            [](char c) { return c == ' '; });
+
+    // The segments are matched from last to first. For each segment i and
+    // position p, tails holds how many positions from p onward the segments
+    // from i onward can match the rest of the file name at. Keeping counts
+    // rather than flags lets a placeholder test a whole range of lengths in
+    // constant time, which keeps the match linear.
+    std::vector<uint32_t> tails(segments.size() * stride, 0);
+
+    auto tail = [&](size_t i, size_t p) -> uint32_t&
+    {
+        return tails[i * stride + p];
+    };
+
+    auto matches = [&](size_t i, size_t p)
+    {
+        return p <= size && tail(i, p) != tail(i, p + 1);
+    };
+
+    auto anyMatches = [&](size_t i, size_t first, size_t last)
+    {
+        return first <= last && tail(i, first) != tail(i, last + 1);
+    };
+
+    for (size_t i = segments.size(); i-- > 0;)
+    {
+        const Segment& segment = segments[i];
+
+        for (size_t p = size + 1; p-- > 0;)
+        {
+            bool match{ false };
+
+            if (segment.type == NodeType::End)
+            {
+                match = p == size;
+            }
+            else if (segment.type == NodeType::Literal)
+            {
+                const size_t end = p + segment.lexeme.size();
+                match = end <= size && 
+                        fileName.substr(p, segment.lexeme.size()) == 
+                            segment.lexeme &&
+                        matches(i + 1, end);
+            }
+            else
+            {
+                const Lengths lengths = PlaceholderLengths(
+                    segment, fileName, digits, spaces, p);
+                match = anyMatches(i + 1, p + lengths.min, p + lengths.max) ||
+                        (lengths.suffix && 
+                         matches(i + 1, p + lengths.max + 1)) ||
+                        anyMatches(i + 1, p + lengths.End() + 1, 
+                                   p + lengths.End() + lengths.pad);
+            }
+
+            tail(i, p) = tail(i, p + 1) + (match ? 1 : 0);
+        }
+    }
+
+    if (segments.empty() || !matches(0, 0))
+    {
+        return std::nullopt;
+    }
+
+    // Every position marked above leads to a full match, so the values can
+    // be picked in a single pass without ever having to back up.
+    std::vector<Capture> captures;
+    size_t p{ 0 };
+
+    for (size_t i = 0; i < segments.size(); i++)
+    {
+        const Segment& segment = segments[i];
+
+        if (segment.type == NodeType::Literal)
+        {
+            p += segment.lexeme.size();
+        }
+        else if (segment.type != NodeType::End)
+        {
+            const Lengths lengths = PlaceholderLengths(
+                segment, fileName, digits, spaces, p);
+            size_t length{ lengths.min };
+
+            if (IsFreeText(segment))
+            {
+                while (!matches(i + 1, p + length))
+                {
+                    length++;
+                }
+            }
+            else if (anyMatches(i + 1, p + lengths.End() + 1, 
+                                p + lengths.End() + lengths.pad))
+            {
+                length = lengths.End() + lengths.pad;
+
+                while (!matches(i + 1, p + length))
+                {
+                    length--;
+                }
+            }
+            else if (lengths.suffix && matches(i + 1, p + lengths.max + 1))
+            {
+                length = lengths.max + 1;
+            }
+            else
+            {
+                length = lengths.max;
+
+                while (!matches(i + 1, p + length))
+                {
+                    length--;
+                }
+            }
+
+            captures.push_back(Capture{ 
+                segment.field, 
+                segment.format.Trim(fileName.substr(p, length)) });
+            p += length;
+        }
+    }
+
+    return captures;
+}
+
+bool Compiled::Format(const Tag& tag, std::string& output) const
+{
+    output.clear();
+
+    if (!valid)
+    {
+        return false;
+    }
+
+    for (const Segment& segment : segments)
+    {
+        switch (segment.type)
+        {
+            case NodeType::Literal:
+                output += segment.lexeme;
+                break;
+            case NodeType::TextPlaceholder:
+            case NodeType::NumericPlaceholder:
+                segment.format.Append(
+                    output, TagToFileNameValue(tag, *segment.field));
+                break;
+            case NodeType::End:
+                break;
+        }
+    }
+
+    return true;
+}
@@ -23,4 +23,21 @@ namespace Spc::Id666::Pattern
     const char* gamePlaceholder{ "%game%" };
     const char* discPlaceholder{ "%disc%" };
     const char* trackPlaceholder{ "%track%" };
+    const char* dumperPlaceholder{ "%dumper%" };
+    const char* commentsPlaceholder{ "%comments%" };
+    const char* datePlaceholder{ "%date%" };
+    const char* lengthPlaceholder{ "%length%" };
+    const char* fadePlaceholder{ "%fade%" };
+    const char* channelsPlaceholder{ "%channels%" };
+    const char* emulatorPlaceholder{ "%emulator%" };
+    const char* ostPlaceholder{ "%ost%" };
+    const char* publisherPlaceholder{ "%publisher%" };
+    const char* yearPlaceholder{ "%year%" };
+    const char* introPlaceholder{ "%intro%" };
+    const char* loopPlaceholder{ "%loop%" };
+    const char* endPlaceholder{ "%end%" };
+    const char* fadeTicksPlaceholder{ "%fadeticks%" };
+    const char* mutedPlaceholder{ "%muted%" };
+    const char* loopsPlaceholder{ "%loops%" };
+    const char* preampPlaceholder{ "%preamp%" };
 }
\ No newline at end of file
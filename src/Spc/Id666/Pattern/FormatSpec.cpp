@@ -0,0 +1,109 @@
+// FormatSpec.cpp - Defines the Spc::Id666::Pattern::FormatSpec struct.
+//
+// Copyright (C) 2026 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "Spc/Id666/Pattern/FormatSpec.h"
+
+using namespace Spc::Id666::Pattern;
+
+void FormatSpec::Append(std::string& output, std::string_view value) const
+{
+    const size_t padding = value.size() < width ? width - value.size() : 0;
+
+    if (leftAlign)
+    {
+        output.append(value);
+        output.append(padding, fill);
+    }
+    else
+    {
+        output.append(padding, fill);
+        output.append(value);
+    }
+}
+
+std::string_view FormatSpec::Trim(std::string_view value) const
+{
+    if (!IsTrimmed())
+    {
+        return value;
+    }
+
+    if (leftAlign)
+    {
+        const size_t last = value.find_last_not_of(fill);
+        return value.substr(0, last == std::string_view::npos ? 0 : last + 1);
+    }
+
+    const size_t first = value.find_first_not_of(fill);
+    return first == std::string_view::npos ? std::string_view{ } 
+                                           : value.substr(first);
+}
+
+std::optional<FormatSpec> Spc::Id666::Pattern::ParseFormat(
+    std::string_view format)
+{
+    FormatSpec spec{ 0, ' ', false };
+    size_t position{ 0 };
+
+    if (position < format.size() && format[position] == '-')
+    {
+        spec.leftAlign = true;
+        position++;
+    }
+
+    if (position < format.size() && format[position] == '0')
+    {
+        spec.fill = '0';
+        position++;
+    }
+
+    // Zeros on the right would change the value, so they are not allowed.
+    if (spec.leftAlign && spec.fill == '0')
+    {
+        return std::nullopt;
+    }
+
+    // A placeholder without a format has no width, but a format must have
+    // one.
+    if (format.empty())
+    {
+        return spec;
+    }
+    else if (position == format.size())
+    {
+        return std::nullopt;
+    }
+
+    for (; position < format.size(); position++)
+    {
+        const char c = format[position];
+
+        if (c < '0' || c > '9')
+        {
+            return std::nullopt;
+        }
+
+        spec.width = spec.width * 10 + static_cast<size_t>(c - '0');
+
+        if (spec.width > maxFormatWidth)
+        {
+            return std::nullopt;
+        }
+    }
+
+    return spec;
+}
@@ -16,6 +16,7 @@
 
 #include "Spc/Id666/Pattern/Parser.h"
 
+using namespace Spc::Id666;
 using namespace Spc::Id666::Pattern;
 
 std::vector<Node> Parser::Parse() const
@@ -24,7 +25,7 @@ std::vector<Node> Parser::Parse() const
 
     for (const Token& token : tokens)
     {
-        Node node;
+        Node node{ };
 
         switch (token.Type())
         {
@@ -33,8 +34,11 @@ std::vector<Node> Parser::Parse() const
             node.lexeme = token.Lexeme();
             break;
         case TokenType::Placeholder:
-            if (token.Lexeme() == discPlaceholder || 
-                token.Lexeme() == trackPlaceholder)
+            node.placeholder = FindPlaceholder(token.Name());
+
+            if (node.placeholder != nullptr && 
+                (node.placeholder->field->kind == FieldKind::Numeric ||
+                 node.placeholder->field->kind == FieldKind::Track))
             {
                 node.type = NodeType::NumericPlaceholder;
             }
@@ -44,6 +48,7 @@ std::vector<Node> Parser::Parse() const
             }
             
             node.lexeme = token.Lexeme();
+            node.format = token.Format();
             break;
         case TokenType::End:
             node.type = NodeType::End;
@@ -0,0 +1,92 @@
+// Placeholder.cpp - Defines the supported pattern placeholders.
+//
+// Copyright (C) 2026 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "Spc/Id666/Pattern/Placeholder.h"
+
+#include <algorithm>
+
+namespace Spc::Id666::Pattern
+{
+    const std::array<Placeholder, fieldDescriptors.size()> placeholders
+    {{
+        { songPlaceholder, &songTitleField },
+        { gamePlaceholder, &gameTitleField },
+        { dumperPlaceholder, &dumperNameField },
+        { commentsPlaceholder, &commentsField },
+        { datePlaceholder, &dateDumpedField },
+        { lengthPlaceholder, &songLengthField },
+        { fadePlaceholder, &fadeLengthField },
+        { artistPlaceholder, &songArtistField },
+        { channelsPlaceholder, &defaultDisabledChannelsField },
+        { emulatorPlaceholder, &emulatorUsedField },
+        { ostPlaceholder, &ostTitleField },
+        { discPlaceholder, &ostDiscField },
+        { trackPlaceholder, &ostTrackField },
+        { publisherPlaceholder, &publisherNameField },
+        { yearPlaceholder, &copyrightYearField },
+        { introPlaceholder, &introLengthField },
+        { loopPlaceholder, &loopLengthField },
+        { endPlaceholder, &endLengthField },
+        { fadeTicksPlaceholder, &fadeLengthExtField },
+        { mutedPlaceholder, &mutedVoicesField },
+        { loopsPlaceholder, &loopTimesField },
+        { preampPlaceholder, &preampLevelField }
+    }};
+
+    const Placeholder* FindPlaceholder(std::string_view name)
+    {
+        for (const Placeholder& placeholder : placeholders)
+        {
+            // The names in the table include the placeholder characters.
+            const std::string_view full{ placeholder.name };
+
+            if (full.substr(1, full.size() - 2) == name)
+            {
+                return &placeholder;
+            }
+        }
+
+        return nullptr;
+    }
+
+    std::string TagToFileNameValue(const Tag& tag, 
+                                   const FieldDescriptor& field)
+    {
+        std::string value = tag.FieldValue(field);
+
+        if (&field == &dateDumpedField)
+        {
+            std::replace(value.begin(), value.end(), '/', dateSeparatorChar);
+        }
+
+        return value;
+    }
+
+    std::string FileNameToTagValue(const FieldDescriptor& field, 
+                                   std::string_view value)
+    {
+        std::string tagValue{ value };
+
+        if (&field == &dateDumpedField)
+        {
+            std::replace(tagValue.begin(), tagValue.end(), 
+                         dateSeparatorChar, '/');
+        }
+
+        return tagValue;
+    }
+}
@@ -33,4 +33,36 @@ TokenType Token::Type() const
     {
         return TokenType::Literal;
     }
-}
\ No newline at end of file
+}
+
+std::string_view Token::Name() const
+{
+    if (Type() != TokenType::Placeholder)
+    {
+        return { };
+    }
+
+    // Drop the placeholder characters on either side before looking for the
+    // start of the format.
+    const std::string_view inner = lexeme.substr(1, lexeme.size() - 2);
+
+    return inner.substr(0, inner.find(formatChar));
+}
+
+std::string_view Token::Format() const
+{
+    if (Type() != TokenType::Placeholder)
+    {
+        return { };
+    }
+
+    const std::string_view inner = lexeme.substr(1, lexeme.size() - 2);
+    const size_t separator = inner.find(formatChar);
+
+    if (separator == std::string_view::npos)
+    {
+        return { };
+    }
+
+    return inner.substr(separator + 1);
+}
@@ -16,414 +16,1185 @@
 
 #include "Spc/Id666/Tag.h"
 
+#include <algorithm>
 #include <cctype>
+#include "Spc/NumberFormat.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define SPC_TAG_USE_SSE2
+#include <emmintrin.h>
+#endif
 
 using namespace Spc;
 using namespace Spc::Id666;
 
-Tag::Tag()
+namespace
+{
+    // A binary date only uses its first 4 bytes; the rest should be zero.
+    constexpr size_t dateUnusedAreaIndex{ 4 };
+    constexpr char asciiSlash{ 0x2F };
+
+    // Large enough for any numeric field of the tag, in either layout.
+    constexpr size_t maxNumberSize{ 8 };
+
+    // The tag type is determined entirely by the bytes from the date dumped
+    // through the end of the reserved area, in either layout.
+    constexpr size_t typeRegionOffset{ dateDumpedInfo.binary.offset };
+    constexpr size_t typeRegionEnd{ 
+        reservedInfo.binary.offset + reservedInfo.binary.size 
+    };
+
+    constexpr size_t typeRegionSize{ typeRegionEnd - typeRegionOffset };
+    constexpr size_t bitsPerWord{ 64 };
+    constexpr size_t maskWords{ 
+        (typeRegionSize + bitsPerWord - 1) / bitsPerWord 
+    };
+
+    // One bit per byte of the type region, set when the byte is in a class.
+    struct ByteMask
+    {
+        uint64_t words[maskWords]{};
+
+        void Set(size_t index)
+        {
+            words[index / bitsPerWord] |= uint64_t{ 1 } << index % bitsPerWord;
+        }
+
+        // Determines if every byte in the range is in the class.
+        bool All(FieldInfo range) const
+        {
+            size_t index = range.offset - typeRegionOffset;
+            size_t end = index + range.size;
+
+            while (index < end)
+            {
+                size_t bit = index % bitsPerWord;
+                size_t count = std::min(end - index, bitsPerWord - bit);
+                uint64_t bits = count == bitsPerWord 
+                    ? ~uint64_t{ 0 } 
+                    : ((uint64_t{ 1 } << count) - 1) << bit;
+
+                if ((words[index / bitsPerWord] & bits) != bits)
+                {
+                    return false;
+                }
+
+                index += count;
+            }
+
+            return true;
+        }
+
+        bool Test(size_t offset) const
+        {
+            size_t index = offset - typeRegionOffset;
+            return (words[index / bitsPerWord] >> index % bitsPerWord) & 1;
+        }
+    };
+
+    // The classes of bytes the tag type detection looks for. Every byte that
+    // is a zero is also numeric text, and every byte that is numeric text is 
+    // also date text, mirroring NumericField::IsText() and DateField::IsText().
+    struct ByteClasses
+    {
+        ByteMask zero;
+        ByteMask numericText;
+        ByteMask dateText;
+    };
+
+    void ClassifyByte(ByteClasses& classes, size_t index, char byte)
+    {
+        bool isZero = byte == 0;
+        bool isNumericText = isZero || (byte >= asciiZero && byte <= asciiNine);
+
+        if (isZero)
+        {
+            classes.zero.Set(index);
+        }
+
+        if (isNumericText)
+        {
+            classes.numericText.Set(index);
+        }
+
+        if (isNumericText || byte == asciiSlash)
+        {
+            classes.dateText.Set(index);
+        }
+    }
+
+    // Classifies the bytes of the type region from index through its end.
+    void ClassifyBytes(ByteClasses& classes, const char* region, size_t index)
+    {
+        for (; index < typeRegionSize; index++)
+        {
+            ClassifyByte(classes, index, region[index]);
+        }
+    }
+
+    // Classifies every byte of the type region at once so each of the checks 
+    // that determine the tag type is just a test of a few mask bits.
+    ByteClasses ClassifyTypeRegion(const char* region)
+    {
+        ByteClasses classes;
+        size_t index{ 0 };
+
+#ifdef SPC_TAG_USE_SSE2
+        constexpr size_t blockSize{ sizeof(__m128i) };
+        const __m128i zero = _mm_setzero_si128();
+        const __m128i belowZero = _mm_set1_epi8(asciiZero - 1);
+        const __m128i aboveNine = _mm_set1_epi8(asciiNine + 1);
+        const __m128i slash = _mm_set1_epi8(asciiSlash);
+
+        for (; index + blockSize <= typeRegionSize; index += blockSize)
+        {
+            __m128i bytes = _mm_loadu_si128(
+                reinterpret_cast<const __m128i*>(region + index));
+
+            // Bytes with the high bit set compare as negative, so they are
+            // never mistaken for digits.
+            __m128i isZero = _mm_cmpeq_epi8(bytes, zero);
+            __m128i isDigit = _mm_and_si128(_mm_cmpgt_epi8(bytes, belowZero),
+                                            _mm_cmplt_epi8(bytes, aboveNine));
+            __m128i isNumericText = _mm_or_si128(isZero, isDigit);
+            __m128i isDateText = _mm_or_si128(isNumericText, 
+                                              _mm_cmpeq_epi8(bytes, slash));
+
+            // Blocks never straddle a word since 64 is a multiple of 16.
+            size_t word = index / bitsPerWord;
+            size_t shift = index % bitsPerWord;
+            auto bits = [](__m128i m)
+            {
+                return static_cast<uint64_t>(
+                    static_cast<uint16_t>(_mm_movemask_epi8(m)));
+            };
+
+            classes.zero.words[word] |= bits(isZero) << shift;
+            classes.numericText.words[word] |= bits(isNumericText) << shift;
+            classes.dateText.words[word] |= bits(isDateText) << shift;
+        }
+#endif
+
+        ClassifyBytes(classes, region, index);
+        return classes;
+    }
+
+    // The portable kernel, which classifies one byte at a time. It gives the
+    // same classes as ClassifyTypeRegion() on every platform.
+    ByteClasses ClassifyTypeRegionScalar(const char* region)
+    {
+        ByteClasses classes;
+        ClassifyBytes(classes, region, 0);
+        return classes;
+    }
+
+    FieldInfo Unused(FieldInfo date)
+    {
+        return FieldInfo{ date.offset + dateUnusedAreaIndex, 
+                          date.size - dateUnusedAreaIndex };
+    }
+
+    // Applies the checks that determine the tag type to the classified bytes
+    // of the type region.
+    TagType TypeOf(const ByteClasses& classes)
+    {
+        const FieldInfo& dateDumped = dateDumpedInfo.binary;
+
+        if (!classes.dateText.All(dateDumped) || 
+            !classes.numericText.All(songLengthInfo.binary) || 
+            !classes.numericText.All(fadeLengthInfo.binary))
+        {
+            // While we're pretty sure we're binary at this point, let's make 
+            // absolutely sure. Some older dumps use text offsets but still 
+            // store times as binary. Let's check the bytes that are normally
+            // unused in a binary tag for any non-zero values.
+            if (!classes.zero.All(dateDumped))
+            {
+                if (!classes.zero.All(Unused(dateDumped)))
+                {
+                    return TagType::TextMixed;
+                }
+            }
+
+            // If the first byte of artist is 0 but the byte immediately
+            // following is non-zero, this suggests the artist value was 
+            // shifted over by 1, which means we're using text tag offsets.
+            size_t artist = songArtistInfo.binary.offset;
+
+            if (classes.zero.Test(artist) && !classes.zero.Test(artist + 1))
+            {
+                return TagType::TextMixed;
+            }
+
+            // The reserved bytes should also be empty if the offsets are
+            // for a binary tag.
+            if (!classes.zero.All(reservedInfo.binary))
+            {
+                return TagType::TextMixed;
+            }
+
+            // If we've made it this far, we can be pretty sure we're using
+            // binary offsets.
+            return TagType::Binary;
+        }
+
+        return TagType::Text;
+    }
+
+    bool IsZero(ByteView bytes)
+    {
+        for (char byte : bytes)
+        {
+            if (byte != 0)
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    // These mirror NumericField::IsText() and DateField::IsText(), but work on
+    // the bytes in place rather than on a copy in a field.
+    bool IsNumericText(ByteView bytes)
+    {
+        for (char byte : bytes)
+        {
+            bool isAsciiNum = byte >= asciiZero && byte <= asciiNine;
+
+            if (!isAsciiNum && byte != 0)
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    std::string_view Terminated(ByteView bytes)
+    {
+        size_t length{ 0 };
+
+        while (length < bytes.Size() && bytes[length] != 0)
+        {
+            length++;
+        }
+
+        return std::string_view{ bytes.Data(), length };
+    }
+
+    uint32_t LittleEndian(ByteView bytes)
+    {
+        uint32_t value{ 0 };
+
+        for (size_t i = 0; i < bytes.Size() && i < sizeof(value); i++)
+        {
+            value |= static_cast<uint32_t>(static_cast<uint8_t>(bytes[i])) 
+                     << (i * bitsPerByte);
+        }
+
+        return value;
+    }
+
+    uint32_t ParseDecimal(ByteView bytes, size_t& index)
+    {
+        uint32_t value{ 0 };
+        std::string_view text{ bytes.Data() + index, bytes.Size() - index };
+        index += ParseDigits(text, text.size(), value);
+        return value;
+    }
+
+    uint32_t ParseDecimal(ByteView bytes)
+    {
+        size_t index{ 0 };
+        return ParseDecimal(bytes, index);
+    }
+
+    void StoreLittleEndian(uint32_t value, char* destination, size_t size)
+    {
+        for (size_t i = 0; i < size; i++)
+        {
+            destination[i] = i < sizeof(value) 
+                ? static_cast<char>(value >> (i * bitsPerByte)) : 0;
+        }
+    }
+
+    uint32_t DecodeNumeric(ByteView bytes, TagType type)
+    {
+        return type == TagType::Text ? ParseDecimal(bytes) 
+                                     : LittleEndian(bytes);
+    }
+
+    bool IsDateText(ByteView bytes);
+
+    std::optional<Date> DecodeDate(ByteView bytes)
+    {
+        if (IsZero(bytes))
+        {
+            return std::nullopt;
+        }
+
+        if (IsDateText(bytes))
+        {
+            return Date::Parse(Terminated(bytes));
+        }
+
+        // Binary dates are a byte for the day and month, then a 16-bit year.
+        Date date;
+        date.day = static_cast<uint8_t>(bytes[0]);
+        date.month = static_cast<uint8_t>(bytes[1]);
+        date.year = static_cast<uint16_t>(LittleEndian(bytes.Subview(2, 2)));
+
+        if (!date.IsValid())
+        {
+            return std::nullopt;
+        }
+
+        return date;
+    }
+
+    // Length items keep their value in the header's data field, while the
+    // other types follow the header with it.
+    uint32_t ItemNumber(const Extended::ItemView& item)
+    {
+        return item.type == Extended::lengthType ? item.data 
+                                                 : LittleEndian(item.payload);
+    }
+
+    bool IsDateText(ByteView bytes)
+    {
+        for (char byte : bytes)
+        {
+            bool isAsciiNum = byte >= asciiZero && byte <= asciiNine;
+
+            if (!isAsciiNum && byte != 0 && byte != asciiSlash)
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    template<typename T>
+    std::optional<T> Narrow(std::optional<uint32_t> value)
+    {
+        if (!value.has_value())
+        {
+            return std::nullopt;
+        }
+
+        return static_cast<T>(*value);
+    }
+
+    // Determines if a number of the given size can hold every value up to
+    // max, as text digits or as a little endian binary number.
+    constexpr bool Holds(size_t size, int64_t max, bool isText)
+    {
+        int64_t limit = 1;
+
+        for (size_t i = 0; i < size && limit <= max; i++)
+        {
+            limit *= isText ? 10 : 256;
+        }
+
+        return max < limit;
+    }
+
+    // Catches a descriptor wired to the wrong item, or given a range its
+    // storage cannot hold, when the library is compiled.
+    constexpr bool DescriptorsAreConsistent()
+    {
+        for (size_t i = 0; i < fieldDescriptors.size(); i++)
+        {
+            const FieldDescriptor& field = *fieldDescriptors[i];
+
+            if (!field.InTag() && !field.IsExtended())
+            {
+                return false;
+            }
+
+            if (field.IsExtended() != (field.member != nullptr))
+            {
+                return false;
+            }
+
+            if (field.IsExtended() && (field.kind == FieldKind::Text) != 
+                (field.item->type == Extended::stringType))
+            {
+                return false;
+            }
+
+            for (size_t j = i + 1; j < fieldDescriptors.size(); j++)
+            {
+                const FieldDescriptor& other = *fieldDescriptors[j];
+
+                if (field.IsExtended() && other.IsExtended() && 
+                    (field.item->id == other.item->id || 
+                     field.member == other.member))
+                {
+                    return false;
+                }
+            }
+
+            if (!field.HasRange())
+            {
+                continue;
+            }
+
+            if (field.InTag() && 
+                (!Holds(field.info->text.size, field.max, true) ||
+                 !Holds(field.info->binary.size, field.max, false)))
+            {
+                return false;
+            }
+
+            if (field.IsExtended() && 
+                field.item->type == Extended::lengthType &&
+                !Holds(Extended::dataInfo.size, field.max, false))
+            {
+                return false;
+            }
+
+            if (field.IsExtended() && 
+                field.item->type == Extended::integerType &&
+                !Holds(Extended::integerSize, field.max, false))
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    static_assert(DescriptorsAreConsistent(), 
+                  "A tag field descriptor is inconsistent.");
+
+    void CheckKnown(const FieldDescriptor& descriptor)
+    {
+        if (std::find(fieldDescriptors.begin(), 
+                      fieldDescriptors.end(), 
+                      &descriptor) == fieldDescriptors.end())
+        {
+            throw std::invalid_argument("Unknown tag field descriptor.");
+        }
+    }
+}
+
+Tag::Tag()
+{
+    fieldData = std::make_shared<Binary::BufferStream>(tagSize);
+    extendedData = std::make_shared<Extended::Data>();
+    cachedType = std::make_shared<std::optional<TagType>>();
+    loadedItems = std::make_shared<Extended::ItemTable>();
+}
+
+void Tag::SetExtendedItems(Extended::ItemTable items)
+{
+    for (auto member : Extended::Data::Items())
+    {
+        extendedData.get()->*member = nullptr;
+    }
+
+    *loadedItems = std::move(items);
+}
+
+Extended::ItemTable Tag::ExtendedItems() const
+{
+    if (extendedData->Size() == 0)
+    {
+        return *loadedItems;
+    }
+
+    // Some items have been decoded, so they are combined with the ones that
+    // have not been read yet.
+    Extended::ItemTable items = Extended::ItemTable::FromData(*extendedData);
+    items.Reserve(items.Size() + loadedItems->Size());
+
+    for (Extended::ItemView item : *loadedItems)
+    {
+        items.Set(item);
+    }
+
+    return items;
+}
+
+void Tag::DecodeLoadedItems() const
+{
+    if (!loadedItems->Empty())
+    {
+        loadedItems->DecodeInto(*extendedData);
+        loadedItems->Clear();
+    }
+}
+
+void Tag::DecodeLoadedItem(const FieldDescriptor& descriptor) const
+{
+    const uint8_t id = descriptor.item->id;
+
+    if (loadedItems->Contains(id))
+    {
+        loadedItems->DecodeInto(*extendedData, id);
+        loadedItems->Remove(id);
+    }
+}
+
+bool Tag::HasExtendedData() const
+{
+    return !loadedItems->Empty() || extendedData->Size() > 0;
+}
+
+TagType Tag::DetermineType() const
+{
+    if (!cachedType->has_value())
+    {
+        *cachedType = DetermineType(
+            ByteView{ fieldData->RawData(), fieldData->Size() });
+    }
+
+    return **cachedType;
+}
+
+TagType Tag::DetermineType(ByteView data)
+{
+    ByteView region = data.Subview(0, tagSize).Subview(
+        typeRegionOffset - tagOffset, typeRegionSize);
+    return TypeOf(ClassifyTypeRegion(region.Data()));
+}
+
+TagType Tag::DetermineTypeScalar(ByteView data)
+{
+    ByteView region = data.Subview(0, tagSize).Subview(
+        typeRegionOffset - tagOffset, typeRegionSize);
+    return TypeOf(ClassifyTypeRegionScalar(region.Data()));
+}
+
+TagRecord Tag::Decode() const
+{
+    TagRecord record;
+    const TagType type = DetermineType();
+
+    auto field = [this, type](const TagFieldInfo& info)
+    {
+        return FieldBytes(info, type);
+    };
+
+    auto numeric = [type](ByteView bytes)
+    {
+        return DecodeNumeric(bytes, type);
+    };
+
+    // Items are viewed rather than decoded, so taking a snapshot neither
+    // allocates nor decodes the items that have not been read yet.
+    auto text = [this, &field](const FieldDescriptor& descriptor)
+    {
+        if (std::optional<Extended::ItemView> item = FindItem(descriptor))
+        {
+            return Terminated(item->payload);
+        }
+
+        return descriptor.InTag() ? Terminated(field(*descriptor.info)) 
+                                  : std::string_view{};
+    };
+
+    record.songTitle = text(songTitleField);
+    record.gameTitle = text(gameTitleField);
+    record.dumperName = text(dumperNameField);
+    record.comments = text(commentsField);
+    record.songArtist = text(songArtistField);
+    record.songLength = numeric(field(songLengthInfo));
+    record.fadeLength = numeric(field(fadeLengthInfo));
+    record.defaultDisabledChannels = static_cast<uint8_t>(
+        field(defaultDisabledChannelsInfo)[0]);
+
+    record.dateDumped = DateDumpedValue();
+
+    if (std::optional<Extended::ItemView> item = FindItem(emulatorUsedField))
+    {
+        record.emulatorUsed = static_cast<uint8_t>(ItemNumber(*item));
+    }
+    else
+    {
+        // Like EmulatorField, the value may be text even in a binary tag.
+        ByteView emulator = field(emulatorUsedInfo);
+        record.emulatorUsed = static_cast<uint8_t>(
+            IsNumericText(emulator) ? ParseDecimal(emulator) 
+                                    : LittleEndian(emulator));
+    }
+
+    record.ostTitle = text(ostTitleField);
+    record.publisherName = text(publisherNameField);
+
+    if (std::optional<Extended::ItemView> item = FindItem(ostTrackField))
+    {
+        // The track number is in the upper byte and the suffix in the lower.
+        const uint32_t track = ItemNumber(*item);
+        record.ostTrack = static_cast<uint8_t>(track >> bitsPerByte);
+        record.ostTrackSuffix = static_cast<char>(track);
+    }
+
+    record.ostDisc = Narrow<uint8_t>(NumberValue(ostDiscField));
+    record.copyrightYear = Narrow<uint16_t>(NumberValue(copyrightYearField));
+    record.mutedVoices = Narrow<uint8_t>(NumberValue(mutedVoicesField));
+    record.loopTimes = Narrow<uint8_t>(NumberValue(loopTimesField));
+    record.introLength = NumberValue(introLengthField);
+    record.loopLength = NumberValue(loopLengthField);
+    record.endLength = NumberValue(endLengthField);
+    record.fadeLengthExt = NumberValue(fadeLengthExtField);
+    record.preampLevel = NumberValue(preampLevelField);
+    return record;
+}
+
+std::string Tag::FieldValue(const FieldDescriptor& descriptor) const
+{
+    CheckKnown(descriptor);
+
+    switch (descriptor.kind)
+    {
+        case FieldKind::Date:
+            return ReadField<DateField>(descriptor).Value();
+        case FieldKind::Numeric:
+            return ReadField<NumericField>(descriptor).Value();
+        case FieldKind::Binary:
+            return ReadField<BinaryField>(descriptor).Value();
+        case FieldKind::Emulator:
+            return ReadField<EmulatorField>(descriptor).Value();
+        case FieldKind::Track:
+            return ReadField<TrackField>(descriptor).Value();
+        case FieldKind::Text:
+            break;
+    }
+
+    return ReadField<TextField>(descriptor).Value();
+}
+
+void Tag::SetFieldValue(const FieldDescriptor& descriptor, 
+                        const std::string& value)
+{
+    CheckKnown(descriptor);
+    WriteField(descriptor, value);
+}
+
+TextField Tag::SongTitle() const 
+{
+    return ReadField<TextField>(songTitleField);
+}
+
+TextField Tag::GameTitle() const 
+{
+    return ReadField<TextField>(gameTitleField);
+}
+
+TextField Tag::DumperName() const 
+{
+    return ReadField<TextField>(dumperNameField);
+}
+
+TextField Tag::Comments() const 
+{
+    return ReadField<TextField>(commentsField);
+}
+
+DateField Tag::DateDumped() const 
+{
+    return ReadField<DateField>(dateDumpedField);
+}
+
+NumericField Tag::SongLength() const 
+{   
+    return ReadField<NumericField>(songLengthField);
+}
+
+NumericField Tag::FadeLength() const 
+{
+    return ReadField<NumericField>(fadeLengthField);
+}
+
+TextField Tag::SongArtist() const 
+{
+    return ReadField<TextField>(songArtistField);
+}
+
+BinaryField Tag::DefaultDisabledChannels() const 
+{
+    return ReadField<BinaryField>(defaultDisabledChannelsField);
+}
+
+EmulatorField Tag::EmulatorUsed() const
+{
+    return ReadField<EmulatorField>(emulatorUsedField);
+}
+
+TextField Tag::OstTitle() const 
+{
+    return ReadField<TextField>(ostTitleField);
+}
+
+NumericField Tag::OstDisc() const
+{
+    return ReadField<NumericField>(ostDiscField);
+}
+
+TrackField Tag::OstTrack() const
+{
+    return ReadField<TrackField>(ostTrackField);
+}
+
+TextField Tag::PublisherName() const 
+{
+    return ReadField<TextField>(publisherNameField);
+}
+
+NumericField Tag::CopyrightYear() const
+{
+    return ReadField<NumericField>(copyrightYearField);
+}
+
+NumericField Tag::IntroLength() const 
+{
+    return ReadField<NumericField>(introLengthField);
+}
+
+NumericField Tag::LoopLength() const 
 {
-    fieldData = std::make_shared<Binary::BufferStream>(tagSize);
-    extendedData = std::make_shared<Extended::Data>();
+    return ReadField<NumericField>(loopLengthField);
 }
 
-bool Tag::HasExtendedData() const
+NumericField Tag::EndLength() const 
 {
-    return extendedData->SpcFields().size() > 0;
+    return ReadField<NumericField>(endLengthField);
 }
 
-TagType Tag::DetermineType() const
+NumericField Tag::FadeLengthExt() const 
 {
-    // Preserve the existing position as we have to jump around the tag data to
-    // determine if the tag is binary and we need to get back to where we were.
-    uintmax_t previousPosition = fieldData->Position();
-
-    // Read in the fields that will help us determine the tag type.
-    fieldData->SetPosition(0);
-    DateField dateDumped{ "Date Dumped", dateDumpedInfo.binary };
-    NumericField songLength{ "Song Length (seconds)", songLengthInfo.binary };
-    NumericField fadeLength{ "Fade Length (ms)", fadeLengthInfo.binary };
-    TextField songArtist{ "Song Artist", songArtistInfo.binary };
-    TextField reserved{ "Reserved", reservedInfo.binary };
-    fieldData->SetPosition(dateDumpedInfo.binary.offset - tagOffset);
-    fieldData->Read(dateDumped);
-    fieldData->SetPosition(songLengthInfo.binary.offset - tagOffset);
-    fieldData->Read(songLength);
-    fieldData->SetPosition(fadeLengthInfo.binary.offset - tagOffset);
-    fieldData->Read(fadeLength);
-    fieldData->SetPosition(songArtistInfo.binary.offset - tagOffset);
-    fieldData->Read(songArtist);
-    fieldData->SetPosition(reservedInfo.binary.offset - tagOffset);
-    fieldData->Read(reserved);
-
-    if (!dateDumped.IsText() || !songLength.IsText() || !fadeLength.IsText())
-    {
-        // While we're pretty sure we're binary at this point, let's make 
-        // absolutely sure. Some older dumps use text offsets but still store
-        // times as binary. Let's check the bytes that are normally unused in
-        // a binary tag for any non-zero values.
-        if (dateDumped.IsSet())
-        {
-            if (!dateDumped.HasUnusedArea())
-            {
-                fieldData->SetPosition(previousPosition);
-                return TagType::TextMixed;
-            }
-        }
+    return ReadField<NumericField>(fadeLengthExtField);
+}
 
-        // If the first byte of artist is 0 but the byte immediately
-        // following is non-zero, this suggests the artist value was shifted
-        // over by 1, which means we're using text tag offsets.
-        if (songArtist.RawData()[0] == 0 && songArtist.RawData()[1] != 0)
-        {
-            fieldData->SetPosition(previousPosition);
-            return TagType::TextMixed;
-        }
+BinaryField Tag::MutedVoices() const 
+{
+    return ReadField<BinaryField>(mutedVoicesField);
+}
 
-        // The reserved bytes should also be empty if the offsets are
-        // for a binary tag.
-        for (int i = 0; i < reserved.Size(); i++)
-        {
-            if (reserved.RawData()[i] != 0)
-            {
-                fieldData->SetPosition(previousPosition);
-                return TagType::TextMixed;
-            }
-        }
+NumericField Tag::LoopTimes() const 
+{
+    return ReadField<NumericField>(loopTimesField);
+}
 
-        // If we've made it this far, we can be pretty sure we're using
-        // binary offsets.
-        fieldData->SetPosition(previousPosition);
-        return TagType::Binary;
-    }
+NumericField Tag::PreampLevel() const 
+{
+    return ReadField<NumericField>(preampLevelField);
+}
 
-    fieldData->SetPosition(previousPosition);
-    return TagType::Text;
+void Tag::SetSongTitle(const std::string& value)
+{
+    WriteField(songTitleField, value);
 }
 
-TextField Tag::SongTitle() const 
+void Tag::SetGameTitle(const std::string& value)
 {
-    return *ReadExtendedTextField<TextField>("Song Title", 
-                                             songTitleInfo, 
-                                             extendedData->songTitle.get());
+    WriteField(gameTitleField, value);
 }
 
-TextField Tag::GameTitle() const 
+void Tag::SetDumperName(const std::string& value)
 {
-    return *ReadExtendedTextField<TextField>("Game Title", 
-                                             gameTitleInfo, 
-                                             extendedData->gameTitle.get());
+    WriteField(dumperNameField, value);
 }
 
-TextField Tag::DumperName() const 
+void Tag::SetComments(const std::string& value)
 {
-    return *ReadExtendedTextField<TextField>("Dumper Name", 
-                                             dumperNameInfo, 
-                                             extendedData->dumperName.get());
+    WriteField(commentsField, value);
 }
 
-TextField Tag::Comments() const 
+void Tag::SetDateDumped(const std::string& value)
 {
-    return *ReadExtendedTextField<TextField>("Comments", 
-                                             commentsInfo, 
-                                             extendedData->comments.get());
+    WriteField(dateDumpedField, value);
 }
 
-DateField Tag::DateDumped() const 
+void Tag::SetSongLength(const std::string& value)
 {
-    std::shared_ptr<Extended::Item> item = extendedData->dateDumped;
+    WriteField(songLengthField, value);
+}
 
-    // Date Dumped is stored as an 32-bit integer in the extended area, so
-    // we need to read it differently from the standard date dumped field.
-    std::shared_ptr<NumericField> dateDumpedInt;
-    dateDumpedInt = ReadExtendedField<NumericField>("Date Dumped", item.get());
+void Tag::SetFadeLength(const std::string& value)
+{
+    WriteField(fadeLengthField, value);
+}
 
-    if (item != nullptr)
-    {
-        // Since a date dumped was found in the extended area, convert it to
-        // a standard DateField to return.
-        Spc::FieldInfo extendedInfo;
-        extendedInfo.offset = Extended::dataOffset;
-        extendedInfo.size = dateDumpedInfo.binary.size;
-        DateField dateDumped{ "Date Dumped*", extendedInfo };
-        dateDumpedInt->CopyRawDataTo(dateDumped);
-        return dateDumped;
-    }
-    else
-    {
-        return *ReadNumericField<DateField>("Date Dumped", dateDumpedInfo);
-    }
+void Tag::SetSongArtist(const std::string& value)
+{
+    WriteField(songArtistField, value);
 }
 
-NumericField Tag::SongLength() const 
-{   
-    return *ReadNumericField<NumericField>("Song Length (seconds)", 
-                                           songLengthInfo);
+void Tag::SetDefaultDisabledChannels(const std::string& value)
+{
+    WriteField(defaultDisabledChannelsField, value);
 }
 
-NumericField Tag::FadeLength() const 
+void Tag::SetEmulatorUsed(const std::string& value)
 {
-    return *ReadNumericField<NumericField>("Fade Length (ms)", 
-                                           fadeLengthInfo);
+    WriteField(emulatorUsedField, value);
 }
 
-TextField Tag::SongArtist() const 
+void Tag::SetOstTitle(const std::string& value)
 {
-    return *ReadExtendedTextField<TextField>("Song Artist", 
-                                             songArtistInfo, 
-                                             extendedData->songArtist.get());
+    WriteField(ostTitleField, value);
 }
 
-BinaryField Tag::DefaultDisabledChannels() const 
+void Tag::SetOstDisc(const std::string& value)
 {
-    return *ReadTextField<BinaryField>("Default Disabled Channels", 
-                                       defaultDisabledChannelsInfo);
+    WriteField(ostDiscField, value);
 }
 
-EmulatorField Tag::EmulatorUsed() const
+void Tag::SetOstTrack(const std::string& value)
 {
-    std::shared_ptr<Extended::Item> item = extendedData->emulatorUsed;
-    
-    // Emulator used is stored as an 16-bit integer in the extended area, so
-    // we need to read it differently from the standard emulator used field.
-    std::shared_ptr<NumericField> emulatorUsedInt;
-    emulatorUsedInt = ReadExtendedField<NumericField>("Emulator Used", 
-                                                      item.get());
-
-    if (item != nullptr)
-    {
-        // Since emulator used was found in the extended area, convert it to
-        // a standard EmulatorField to return.
-        Spc::FieldInfo extendedInfo;
-        extendedInfo.offset = Extended::dataOffset;
-        extendedInfo.size = emulatorUsedInfo.binary.size;
-        EmulatorField emulatorUsed{ "Emulator Used*", extendedInfo };
-        emulatorUsedInt->CopyRawDataTo(emulatorUsed);
-        return emulatorUsed;
+    WriteField(ostTrackField, value);
+}
+
+void Tag::SetPublisherName(const std::string& value)
+{
+    WriteField(publisherNameField, value);
+}
+
+void Tag::SetCopyrightYear(const std::string& value)
+{
+    WriteField(copyrightYearField, value);
+}
+
+void Tag::SetIntroLength(const std::string& value)
+{
+    WriteField(introLengthField, value);
+}
+
+void Tag::SetLoopLength(const std::string& value)
+{
+    WriteField(loopLengthField, value);
+}
+
+void Tag::SetEndLength(const std::string& value)
+{
+    WriteField(endLengthField, value);
+}
+
+void Tag::SetFadeLengthExt(const std::string& value)
+{
+    WriteField(fadeLengthExtField, value);
+}
+
+void Tag::SetMutedVoices(const std::string& value)
+{
+    WriteField(mutedVoicesField, value);
+}
+
+void Tag::SetLoopTimes(const std::string& value)
+{
+    WriteField(loopTimesField, value);
+}
+
+void Tag::SetPreampLevel(const std::string& value)
+{
+    WriteField(preampLevelField, value);
+}
+
+std::optional<uint32_t> Tag::SongLengthValue() const
+{
+    return NumberValue(songLengthField);
+}
+
+std::optional<uint32_t> Tag::FadeLengthValue() const
+{
+    return NumberValue(fadeLengthField);
+}
+
+std::optional<Date> Tag::DateDumpedValue() const
+{
+    if (std::optional<Extended::ItemView> item = FindItem(dateDumpedField))
+    {
+        return DecodeDate(item->payload);
     }
-    else
+
+    return DecodeDate(FieldBytes(dateDumpedInfo, DetermineType()));
+}
+
+std::optional<uint8_t> Tag::OstDiscValue() const
+{
+    return Narrow<uint8_t>(NumberValue(ostDiscField));
+}
+
+std::optional<uint8_t> Tag::OstTrackValue() const
+{
+    std::optional<uint32_t> value = NumberValue(ostTrackField);
+
+    if (!value.has_value())
     {
-        return *ReadNumericField<EmulatorField>("Emulator Used", 
-                                                emulatorUsedInfo);
+        return std::nullopt;
     }
+
+    // The track number is in the upper byte and the suffix in the lower.
+    return static_cast<uint8_t>(*value >> bitsPerByte);
 }
 
-TextField Tag::OstTitle() const 
+std::optional<uint16_t> Tag::CopyrightYearValue() const
 {
-    return *ReadExtendedField<TextField>("OST Title", 
-                                         extendedData->ostTitle.get());
+    return Narrow<uint16_t>(NumberValue(copyrightYearField));
 }
 
-NumericField Tag::OstDisc() const
+std::optional<uint32_t> Tag::IntroLengthValue() const
 {
-    return *ReadExtendedField<NumericField>("OST Disc", 
-                                            extendedData->ostDisc.get());
+    return NumberValue(introLengthField);
 }
 
-TrackField Tag::OstTrack() const
+std::optional<uint32_t> Tag::LoopLengthValue() const
 {
-    return *ReadExtendedField<TrackField>("OST Track", 
-                                          extendedData->ostTrack.get());
+    return NumberValue(loopLengthField);
 }
 
-TextField Tag::PublisherName() const 
+std::optional<uint32_t> Tag::EndLengthValue() const
 {
-    return *ReadExtendedField<TextField>("Publisher Name", 
-                                         extendedData->publisherName.get());
+    return NumberValue(endLengthField);
 }
 
-NumericField Tag::CopyrightYear() const
+std::optional<uint32_t> Tag::FadeLengthExtValue() const
 {
-    return *ReadExtendedField<NumericField>("Copyright Year", 
-                                            extendedData->copyrightYear.get());
+    return NumberValue(fadeLengthExtField);
 }
 
-NumericField Tag::IntroLength() const 
+std::optional<uint8_t> Tag::LoopTimesValue() const
 {
-    return *ReadExtendedField<NumericField>("Intro Length (ticks)", 
-                                            extendedData->introLength.get());
+    return Narrow<uint8_t>(NumberValue(loopTimesField));
 }
 
-NumericField Tag::LoopLength() const 
+std::optional<uint32_t> Tag::PreampLevelValue() const
 {
-    return *ReadExtendedField<NumericField>("Loop Length (ticks)", 
-                                            extendedData->loopLength.get());
+    return NumberValue(preampLevelField);
 }
 
-NumericField Tag::EndLength() const 
+void Tag::SetSongLength(uint32_t seconds)
 {
-    return *ReadExtendedField<NumericField>("End Length (ticks)", 
-                                            extendedData->endLength.get());
+    CheckRange(seconds, songLengthField.min, songLengthField.max);
+    WriteNumber(*songLengthField.info, seconds);
 }
 
-NumericField Tag::FadeLengthExt() const 
+void Tag::SetFadeLength(uint32_t milliseconds)
 {
-    return *ReadExtendedField<NumericField>("Fade Length (ticks)", 
-                                            extendedData->fadeLength.get());
+    CheckRange(milliseconds, fadeLengthField.min, fadeLengthField.max);
+    WriteNumber(*fadeLengthField.info, milliseconds);
 }
 
-BinaryField Tag::MutedVoices() const 
+void Tag::SetDateDumped(const Date& date)
 {
-    std::shared_ptr<Extended::Item> item = extendedData->mutedVoices;
-    
-    // Muted voices is stored as an 16-bit integer in the extended area, so
-    // we need to read it differently from the standard BinaryField field.
-    std::shared_ptr<NumericField> mutedVoicesInt;
-    mutedVoicesInt = ReadExtendedField<NumericField>("Muted Voices*", 
-                                                     item.get());
+    if (!date.IsValid())
+    {
+        throw std::invalid_argument("Invalid date dumped value.");
+    }
+
+    *ItemPointer(dateDumpedField) = nullptr;
 
-    if (item != nullptr)
+    TagType type = DetermineType();
+    const FieldInfo& layout = type == TagType::Binary ? dateDumpedInfo.binary
+                                                      : dateDumpedInfo.text;
+    char buffer[dateDumpedInfo.text.size]{};
+
+    // Like DateField, mixed tags keep their dates as text.
+    if (type == TagType::Binary)
     {
-        // Since muted voices was found in the extended area, convert it to
-        // a standard BinaryField to return.
-        Spc::FieldInfo extendedInfo{ Extended::dataOffset, 1 };
-        BinaryField mutedVoices{ "Muted Voices*", extendedInfo };
-        mutedVoicesInt->CopyRawDataTo(mutedVoices);
-        return mutedVoices;
+        buffer[0] = static_cast<char>(date.day);
+        buffer[1] = static_cast<char>(date.month);
+        StoreLittleEndian(date.year, buffer + 2, 2);
     }
     else
     {
-        Spc::FieldInfo errorInfo{ 0, 1 };
-        return BinaryField{ "Muted Voices*", errorInfo, false };
+        date.Format(buffer);
     }
+
+    WriteBytes(layout.offset, ByteView{ buffer, layout.size });
 }
 
-NumericField Tag::LoopTimes() const 
+void Tag::SetOstDisc(uint8_t disc)
 {
-    return *ReadExtendedField<NumericField>("Loop Times", 
-                                            extendedData->loopTimes.get());
+    CheckRange(disc, ostDiscField.min, ostDiscField.max);
+    WriteExtendedLength(ostDiscField, disc);
 }
 
-NumericField Tag::PreampLevel() const 
+void Tag::SetOstTrack(uint8_t track, char suffix)
 {
-    return *ReadExtendedField<NumericField>("Preamp Level", 
-                                            extendedData->preampLevel.get());
+    CheckRange(track, ostTrackField.min, ostTrackField.max);
+
+    // The track number is in the upper byte and the suffix in the lower.
+    uint16_t value = static_cast<uint16_t>(track << bitsPerByte | 
+                                           static_cast<uint8_t>(suffix));
+    WriteExtendedLength(ostTrackField, value);
 }
 
-void Tag::SetSongTitle(const std::string& value)
+void Tag::SetCopyrightYear(uint16_t year)
 {
-    WriteExtendedTextField<TextField>(songTitleInfo,
-                                      Extended::songTitleInfo, 
-                                      &extendedData->songTitle,
-                                      value);
+    WriteExtendedLength(copyrightYearField, year);
 }
 
-void Tag::SetGameTitle(const std::string& value)
+void Tag::SetIntroLength(uint32_t ticks)
 {
-    WriteExtendedTextField<TextField>(gameTitleInfo,
-                                      Extended::gameTitleInfo, 
-                                      &extendedData->gameTitle,
-                                      value);
+    CheckRange(ticks, introLengthField.min, introLengthField.max);
+    WriteExtendedInt(introLengthField, ticks);
 }
 
-void Tag::SetDumperName(const std::string& value)
+void Tag::SetLoopLength(uint32_t ticks)
 {
-    WriteExtendedTextField<TextField>(dumperNameInfo,
-                                      Extended::dumperNameInfo, 
-                                      &extendedData->dumperName,
-                                      value);
+    CheckRange(ticks, loopLengthField.min, loopLengthField.max);
+    WriteExtendedInt(loopLengthField, ticks);
 }
 
-void Tag::SetComments(const std::string& value)
+void Tag::SetEndLength(uint32_t ticks)
 {
-    WriteExtendedTextField<TextField>(commentsInfo,
-                                      Extended::commentsInfo, 
-                                      &extendedData->comments,
-                                      value);
+    CheckRange(ticks, endLengthField.min, endLengthField.max);
+    WriteExtendedInt(endLengthField, ticks);
 }
 
-void Tag::SetDateDumped(const std::string& value)
+void Tag::SetFadeLengthExt(uint32_t ticks)
 {
-    if (value.empty())
-    {
-        extendedData->dateDumped = nullptr;
-    }
+    CheckRange(ticks, fadeLengthExtField.min, fadeLengthExtField.max);
+    WriteExtendedInt(fadeLengthExtField, ticks);
+}
 
-    WriteNumericField<DateField>(dateDumpedInfo,
-                                 value);
+void Tag::SetLoopTimes(uint8_t times)
+{
+    CheckRange(times, loopTimesField.min, loopTimesField.max);
+    WriteExtendedLength(loopTimesField, times);
 }
 
-void Tag::SetSongLength(const std::string& value)
+void Tag::SetPreampLevel(uint32_t level)
+{
+    CheckRange(level, preampLevelField.min, preampLevelField.max);
+    WriteExtendedInt(preampLevelField, level);
+}
+
+void Tag::ReadField(Field& field) const
+{
+    size_t originalPosition = fieldData->Position();
+    fieldData->SetPosition(field.Offset() - tagOffset);
+    fieldData->Read(field);
+    fieldData->SetPosition(originalPosition);
+}
+
+void Tag::WriteField(const Field& field)
 {
-    if (!value.empty())
+    if (field.Offset() < typeRegionEnd && 
+        field.Offset() + field.Size() > typeRegionOffset)
     {
-        constexpr int min{ 0 };
-        constexpr int max{ 959 };
-        CheckRange(value, min, max);
+        cachedType->reset();
     }
 
-    WriteNumericField<NumericField>(songLengthInfo, value);
+    size_t originalPosition = fieldData->Position();
+    fieldData->SetPosition(field.Offset() - tagOffset);
+    fieldData->Write(field);
+    fieldData->SetPosition(originalPosition);
 }
 
-void Tag::SetFadeLength(const std::string& value)
+void Tag::WriteBytes(size_t offset, ByteView bytes)
 {
-    if (!value.empty())
+    if (offset < typeRegionEnd && offset + bytes.Size() > typeRegionOffset)
     {
-        constexpr int min{ 0 };
-        constexpr int max{ 59999 };
-        CheckRange(value, min, max);
+        cachedType->reset();
     }
 
-    WriteNumericField<NumericField>(fadeLengthInfo, value);
+    std::copy(bytes.begin(), bytes.end(), 
+              fieldData->RawData() + offset - tagOffset);
 }
 
-void Tag::SetSongArtist(const std::string& value)
+ByteView Tag::FieldBytes(const TagFieldInfo& info, TagType type) const
 {
-    WriteExtendedTextField<TextField>(songArtistInfo,
-                                      Extended::songArtistInfo, 
-                                      &extendedData->songArtist,
-                                      value);
+    const FieldInfo& layout = type == TagType::Binary ? info.binary 
+                                                      : info.text;
+    ByteView data{ fieldData->RawData(), fieldData->Size() };
+    return data.Subview(layout.offset - tagOffset, layout.size);
 }
 
-void Tag::SetDefaultDisabledChannels(const std::string& value)
+std::optional<uint32_t> Tag::NumberValue(
+    const FieldDescriptor& descriptor) const
 {
-    if (!value.empty() && value.size() != bitsPerByte)
+    if (descriptor.IsExtended())
     {
-        throw std::invalid_argument(
-            "Default disabled channels value must be 8 bits");
+        if (std::optional<Extended::ItemView> item = FindItem(descriptor))
+        {
+            return ItemNumber(*item);
+        }
     }
 
-    WriteNumericField<BinaryField>(defaultDisabledChannelsInfo, value);
-}
+    if (!descriptor.InTag())
+    {
+        return std::nullopt;
+    }
 
-void Tag::SetEmulatorUsed(const std::string& value)
-{
-    if (value.empty())
+    TagType type = DetermineType();
+    ByteView bytes = FieldBytes(*descriptor.info, type);
+
+    if (IsZero(bytes))
     {
-        extendedData->emulatorUsed = nullptr;
+        return std::nullopt;
     }
 
-    WriteNumericField<EmulatorField>(emulatorUsedInfo, value);
+    return DecodeNumeric(bytes, type);
 }
 
-void Tag::SetOstTitle(const std::string& value)
+void Tag::WriteField(const FieldDescriptor& descriptor, 
+                     const std::string& value)
 {
-    WriteExtendedStringField<TextField>(Extended::ostTitleInfo, 
-                                        &extendedData->ostTitle,
-                                        value);
+    switch (descriptor.kind)
+    {
+        case FieldKind::Text:
+            WriteTagField<TextField>(descriptor, value);
+            break;
+        case FieldKind::Date:
+            ClearItemIfEmpty(descriptor, value);
+            WriteTagField<DateField>(descriptor, value);
+            break;
+        case FieldKind::Numeric:
+            // Copyright years have always rejected negative values as 
+            // invalid rather than out of range.
+            if (&descriptor == &copyrightYearField && !value.empty() && 
+                ParseInt32(value) < 0)
+            {
+                throw std::invalid_argument("Value " + value + 
+                                            " must be >= 0");
+            }
+
+            WriteTagField<NumericField>(descriptor, value);
+            break;
+        case FieldKind::Binary:
+            if (!value.empty() && value.size() != bitsPerByte)
+            {
+                throw std::invalid_argument(std::string{ descriptor.label } +
+                                            " value must be 8 bits");
+            }
+
+            WriteTagField<BinaryField>(descriptor, value);
+            break;
+        case FieldKind::Emulator:
+            ClearItemIfEmpty(descriptor, value);
+            WriteTagField<EmulatorField>(descriptor, value);
+            break;
+        case FieldKind::Track:
+            CheckTrack(descriptor, value);
+            WriteTagField<TrackField>(descriptor, value);
+            break;
+    }
 }
 
-void Tag::SetOstDisc(const std::string& value)
+void Tag::ClearItemIfEmpty(const FieldDescriptor& descriptor, 
+                           const std::string& value)
 {
-    if (!value.empty())
+    // The field's item is an integer that the tag field writers do not 
+    // clear, so an empty value has to remove it here.
+    if (value.empty() && descriptor.IsExtended())
     {
-        constexpr int min{ 0 };
-        constexpr int max{ 9 };
-        CheckRange(value, min, max);
+        *ItemPointer(descriptor) = nullptr;
     }
-
-    WriteExtendedLengthField<NumericField>(Extended::ostDiscInfo, 
-                                           &extendedData->ostDisc,
-                                           value);
 }
 
-void Tag::SetOstTrack(const std::string& value)
+void Tag::CheckTrack(const FieldDescriptor& descriptor, 
+                     const std::string& value)
 {
     if (value.empty())
     {
-        WriteExtendedLengthField<TrackField>(Extended::ostTrackInfo,
-                                             &extendedData->ostTrack,
-                                             value);
         return;
     }
 
@@ -444,152 +1215,77 @@ void Tag::SetOstTrack(const std::string& value)
         charSuffix = value.substr(i);
     }
 
-    constexpr int min{ 0 };
-    constexpr int max{ 99 };
-    CheckRange(numericPart, min, max);
+    CheckRange(numericPart, 
+               static_cast<int>(descriptor.min), 
+               static_cast<int>(descriptor.max));
 
     if (charSuffix.size() > 1)
     {
         throw std::invalid_argument("Invalid OST track value: " + value);
     }
-
-    WriteExtendedLengthField<TrackField>(Extended::ostTrackInfo, 
-                                         &extendedData->ostTrack,
-                                         value);
-}
-
-void Tag::SetPublisherName(const std::string& value)
-{
-    WriteExtendedStringField<TextField>(Extended::publisherNameInfo, 
-                                        &extendedData->publisherName,
-                                        value);
-}
-
-void Tag::SetCopyrightYear(const std::string& value)
-{
-    if (value.empty())
-    {
-        WriteExtendedLengthField<NumericField>(Extended::copyrightYearInfo,
-                                               &extendedData->copyrightYear,
-                                               value);
-        return;
-    }
-
-    int intValue = std::stoi(value);
-
-    if (intValue < 0)
-    {
-        throw std::invalid_argument("Value " + value + " must be >= 0");
-    }
-    
-    WriteExtendedLengthField<NumericField>(Extended::copyrightYearInfo, 
-                                           &extendedData->copyrightYear,
-                                           value);
 }
 
-void Tag::SetIntroLength(const std::string& value)
+void Tag::WriteNumber(const TagFieldInfo& info, uint32_t value)
 {
-    if (!value.empty())
-    {
-        CheckRange(value, 0, maxTicks);
-    }
-
-    WriteExtendedIntField<NumericField>(Extended::introLengthInfo, 
-                                        &extendedData->introLength,
-                                        value);
-}
+    TagType type = DetermineType();
+    const FieldInfo& layout = type == TagType::Binary ? info.binary 
+                                                      : info.text;
+    char buffer[maxNumberSize];
 
-void Tag::SetLoopLength(const std::string& value)
-{
-    if (!value.empty())
+    if (type == TagType::Text)
     {
-        CheckRange(value, 0, maxTicks);
+        WriteDigits(value, buffer, layout.size);
     }
-
-    WriteExtendedIntField<NumericField>(Extended::loopLengthInfo, 
-                                        &extendedData->loopLength,
-                                        value);
-}
-
-void Tag::SetEndLength(const std::string& value)
-{
-    if (!value.empty())
+    else
     {
-        CheckRange(value, 0, maxTicks);
+        StoreLittleEndian(value, buffer, layout.size);
     }
 
-    WriteExtendedIntField<NumericField>(Extended::endLengthInfo, 
-                                        &extendedData->endLength,
-                                        value);
+    WriteBytes(layout.offset, ByteView{ buffer, layout.size });
 }
 
-void Tag::SetFadeLengthExt(const std::string& value)
+void Tag::WriteExtendedLength(const FieldDescriptor& descriptor, 
+                              uint16_t value)
 {
-    if (!value.empty())
-    {
-        CheckRange(value, 0, maxTicks);
-    }
-
-    WriteExtendedIntField<NumericField>(Extended::fadeLengthInfo, 
-                                        &extendedData->fadeLength,
-                                        value);
+    Extended::Item& item = FindOrCreateItem(*descriptor.item, 
+                                            ItemPointer(descriptor));
+    StoreLittleEndian(value, item.data->RawData(), item.data->Size());
 }
 
-void Tag::SetMutedVoices(const std::string& value)
+void Tag::WriteExtendedInt(const FieldDescriptor& descriptor, uint32_t value)
 {
-    if (!value.empty() && value.size() != bitsPerByte)
-    {
-        throw std::invalid_argument("Muted voices value must be 8 bits");
-    }
+    Extended::Item& item = FindOrCreateItem(*descriptor.item, 
+                                            ItemPointer(descriptor));
+    item.data->SetInt32(Extended::integerSize);
 
-    WriteExtendedLengthField<BinaryField>(Extended::mutedVoicesInfo, 
-                                          &extendedData->mutedVoices,
-                                          value);
-}
+    auto numeric = dynamic_cast<NumericField*>(item.extendedData.get());
 
-void Tag::SetLoopTimes(const std::string& value)
-{
-    if (!value.empty())
+    if (numeric == nullptr || numeric->Size() != Extended::integerSize)
     {
-        CheckRange(value, 0, maxLoopTimes);
+        FieldInfo info{ Extended::dataOffset, Extended::integerSize };
+        auto field = std::make_shared<NumericField>("Temp", info);
+        numeric = field.get();
+        item.extendedData = field;
     }
 
-    WriteExtendedLengthField<NumericField>(Extended::loopTimesInfo, 
-                                           &extendedData->loopTimes,
-                                           value);
+    numeric->SetType(NumericType::Binary);
+    StoreLittleEndian(value, numeric->RawData(), numeric->Size());
 }
 
-void Tag::SetPreampLevel(const std::string& value)
+void Spc::Id666::CheckRange(int64_t value, int64_t min, int64_t max)
 {
-    if (!value.empty())
+    if (value < min || value > max)
     {
-        CheckRange(value, minPreampLevel, maxPreampLevel);
+        throw std::out_of_range("Value " + std::to_string(value) + 
+                                " is out of range [" + 
+                                std::to_string(min) + ", " + 
+                                std::to_string(max) + "]");
     }
-
-    WriteExtendedIntField<NumericField>(Extended::preampLevelInfo, 
-                                        &extendedData->preampLevel,
-                                        value);
-}
-
-void Tag::ReadField(Field& field) const
-{
-    size_t originalPosition = fieldData->Position();
-    fieldData->SetPosition(field.Offset() - tagOffset);
-    fieldData->Read(field);
-    fieldData->SetPosition(originalPosition);
-}
-
-void Tag::WriteField(const Field& field)
-{
-    size_t originalPosition = fieldData->Position();
-    fieldData->SetPosition(field.Offset() - tagOffset);
-    fieldData->Write(field);
-    fieldData->SetPosition(originalPosition);
 }
 
 void Spc::Id666::CheckRange(const std::string& value, int min, int max)
 {
-    int intValue = std::stoi(value);
+    int intValue = ParseInt32(value);
 
     if (intValue < min || intValue > max)
     {
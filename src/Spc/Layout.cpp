@@ -0,0 +1,166 @@
+// Layout.cpp - Defines the Spc::Layout class methods.
+//
+// Copyright (C) 2026 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "Spc/Layout.h"
+
+#include <string_view>
+#include <system_error>
+#include "Spc/Id666/Pattern/Placeholder.h"
+
+using namespace Spc;
+
+namespace
+{
+    const char directorySeparator{ '/' };
+
+    bool IsUnsafeChar(char c)
+    {
+        return c == '/' || c == '\\' || c == ':' || 
+               static_cast<unsigned char>(c) < 0x20;
+    }
+
+    bool IsSafeComponent(std::string_view component)
+    {
+        return !component.empty() && component != "." && component != "..";
+    }
+}
+
+Layout::Layout(const Id666::Pattern::Compiled& pattern, 
+               const std::filesystem::path& root) :
+    pattern{ pattern }, root{ root }, valid{ pattern.IsValid() }
+{
+    for (const Id666::Pattern::Segment& segment : pattern.Segments())
+    {
+        if (segment.type == Id666::Pattern::NodeType::Literal &&
+            (segment.lexeme.find_first_of("\\:") != std::string::npos))
+        {
+            valid = false;
+        }
+    }
+
+    const std::string& source = pattern.Source();
+    valid = valid && !source.empty() && source.front() != directorySeparator;
+}
+
+std::optional<std::filesystem::path> Layout::Destination(
+    const Id666::Tag& tag) const
+{
+    if (!valid)
+    {
+        return std::nullopt;
+    }
+
+    std::string relative;
+
+    for (const Id666::Pattern::Segment& segment : pattern.Segments())
+    {
+        switch (segment.type)
+        {
+            case Id666::Pattern::NodeType::Literal:
+                relative += segment.lexeme;
+                break;
+            case Id666::Pattern::NodeType::TextPlaceholder:
+            case Id666::Pattern::NodeType::NumericPlaceholder:
+            {
+                // Only the value is sanitized, since the separators in the 
+                // literals are what give the layout its directories.
+                const size_t start = relative.size();
+                segment.format.Append(relative, 
+                                      Id666::Pattern::TagToFileNameValue(
+                                          tag, *segment.field));
+
+                for (size_t i = start; i < relative.size(); i++)
+                {
+                    if (IsUnsafeChar(relative[i]))
+                    {
+                        relative[i] = replacementChar;
+                    }
+                }
+
+                break;
+            }
+            case Id666::Pattern::NodeType::End:
+                break;
+        }
+    }
+
+    std::filesystem::path destination{ root };
+    std::string_view remaining{ relative };
+
+    while (true)
+    {
+        const size_t separator = remaining.find(directorySeparator);
+        const std::string_view component = remaining.substr(0, separator);
+
+        if (!IsSafeComponent(component))
+        {
+            return std::nullopt;
+        }
+
+        destination /= std::string{ component };
+
+        if (separator == std::string_view::npos)
+        {
+            return destination;
+        }
+
+        remaining.remove_prefix(separator + 1);
+    }
+}
+
+std::optional<std::filesystem::path> Layout::Prepare(const Id666::Tag& tag)
+{
+    std::optional<std::filesystem::path> destination = Destination(tag);
+
+    if (!destination.has_value() || 
+        !EnsureDirectory(destination->parent_path()))
+    {
+        return std::nullopt;
+    }
+
+    return destination;
+}
+
+bool Layout::EnsureDirectory(const std::filesystem::path& directory)
+{
+    if (directories.count(directory.string()) > 0)
+    {
+        return true;
+    }
+
+    std::error_code error;
+    std::filesystem::create_directories(directory, error);
+
+    if (error || !std::filesystem::is_directory(directory, error))
+    {
+        return false;
+    }
+
+    // create_directories() made every parent as well, so none of them need
+    // to be checked again either.
+    for (std::filesystem::path p = directory; 
+         !p.empty() && directories.insert(p.string()).second;
+         p = p.parent_path())
+    {
+        if (p == p.parent_path())
+        {
+            break;
+        }
+    }
+
+    return true;
+}
@@ -0,0 +1,155 @@
+// MappedFile.cpp - Defines the Spc::MappedFile class methods.
+//
+// Copyright (C) 2026 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "Spc/MappedFile.h"
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "Spc/FileOperationException.h"
+
+using namespace Spc;
+
+const char* mapOpenError{ "Unable to open file for mapping." };
+const char* mapError{ "Unable to map file into memory." };
+
+#ifdef _WIN32
+
+MappedFile::MappedFile(const std::string& path) : data{ nullptr }, size{ 0 }
+{
+    HANDLE file = CreateFileA(path.c_str(),
+                              GENERIC_READ,
+                              FILE_SHARE_READ,
+                              nullptr,
+                              OPEN_EXISTING,
+                              FILE_ATTRIBUTE_NORMAL,
+                              nullptr);
+
+    if (file == INVALID_HANDLE_VALUE)
+    {
+        throw FileOperationException(mapOpenError);
+    }
+
+    LARGE_INTEGER fileSize;
+
+    if (!GetFileSizeEx(file, &fileSize))
+    {
+        CloseHandle(file);
+        throw FileOperationException(mapError);
+    }
+
+    size = static_cast<size_t>(fileSize.QuadPart);
+
+    // Windows refuses to create a mapping of an empty file, but an empty view
+    // is a perfectly valid result for one.
+    if (size == 0)
+    {
+        CloseHandle(file);
+        return;
+    }
+
+    HANDLE mapping = CreateFileMappingA(file,
+                                        nullptr,
+                                        PAGE_READONLY,
+                                        0,
+                                        0,
+                                        nullptr);
+    CloseHandle(file);
+
+    if (mapping == nullptr)
+    {
+        throw FileOperationException(mapError);
+    }
+
+    // The view keeps its own reference to the mapping object, so the handle
+    // can be closed as soon as the view exists.
+    data = static_cast<const char*>(
+        MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+    CloseHandle(mapping);
+
+    if (data == nullptr)
+    {
+        throw FileOperationException(mapError);
+    }
+}
+
+MappedFile::~MappedFile()
+{
+    if (data != nullptr)
+    {
+        UnmapViewOfFile(data);
+    }
+}
+
+#else
+
+MappedFile::MappedFile(const std::string& path) : data{ nullptr }, size{ 0 }
+{
+    int descriptor = open(path.c_str(), O_RDONLY);
+
+    if (descriptor == -1)
+    {
+        throw FileOperationException(mapOpenError);
+    }
+
+    struct stat status;
+
+    if (fstat(descriptor, &status) == -1)
+    {
+        close(descriptor);
+        throw FileOperationException(mapError);
+    }
+
+    size = static_cast<size_t>(status.st_size);
+
+    // mmap() fails with a length of zero, but an empty view is a perfectly
+    // valid result for an empty file.
+    if (size == 0)
+    {
+        close(descriptor);
+        return;
+    }
+
+    void* address = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, descriptor, 0);
+
+    // The mapping keeps its own reference to the file, so the descriptor can
+    // be closed as soon as the mapping exists.
+    close(descriptor);
+
+    if (address == MAP_FAILED)
+    {
+        throw FileOperationException(mapError);
+    }
+
+    data = static_cast<const char*>(address);
+}
+
+MappedFile::~MappedFile()
+{
+    if (data != nullptr)
+    {
+        munmap(const_cast<char*>(data), size);
+    }
+}
+
+#endif
@@ -0,0 +1,108 @@
+// NumberFormat.cpp - Defines the number formatting and parsing functions.
+//
+// Copyright (C) 2026 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "Spc/NumberFormat.h"
+
+#include <algorithm>
+#include <cctype>
+#include <charconv>
+#include <stdexcept>
+
+using namespace Spc;
+
+const char* notNumericError{ "Value is not numeric." };
+const char* numberRangeError{ "Value is out of range for a 32-bit integer." };
+
+std::string Spc::FormatInteger(int64_t value)
+{
+    char digits[maxIntegerDigits];
+    char* end = std::to_chars(digits, digits + maxIntegerDigits, value).ptr;
+    return std::string(digits, end);
+}
+
+size_t Spc::FormatPadded(uint32_t value, size_t width, char* destination)
+{
+    char digits[maxIntegerDigits];
+    char* end = std::to_chars(digits, digits + maxIntegerDigits, value).ptr;
+    size_t count = static_cast<size_t>(end - digits);
+    size_t padding = width > count ? width - count : 0;
+
+    std::fill_n(destination, padding, '0');
+    std::copy(digits, end, destination + padding);
+    return padding + count;
+}
+
+void Spc::WriteDigits(int64_t value, char* destination, size_t size)
+{
+    char digits[maxIntegerDigits];
+    char* end = std::to_chars(digits, digits + maxIntegerDigits, value).ptr;
+    size_t count = std::min(size, static_cast<size_t>(end - digits));
+
+    std::copy_n(digits, count, destination);
+    std::fill(destination + count, destination + size, 0);
+}
+
+int32_t Spc::ParseInt32(std::string_view text, int base)
+{
+    size_t start{ 0 };
+
+    while (start < text.size() && 
+           std::isspace(static_cast<unsigned char>(text[start])))
+    {
+        start++;
+    }
+
+    // std::from_chars only accepts a minus sign, so a plus sign is skipped 
+    // here as long as it isn't followed by another sign.
+    if (start + 1 < text.size() && text[start] == '+' && 
+        text[start + 1] != '-')
+    {
+        start++;
+    }
+
+    int32_t value{ 0 };
+    auto [end, error] = std::from_chars(text.data() + start, 
+                                        text.data() + text.size(), 
+                                        value, 
+                                        base);
+
+    if (error == std::errc::invalid_argument)
+    {
+        throw std::invalid_argument{ notNumericError };
+    }
+    else if (error == std::errc::result_out_of_range)
+    {
+        throw std::out_of_range{ numberRangeError };
+    }
+
+    return value;
+}
+
+size_t Spc::ParseDigits(std::string_view text, size_t maxDigits, 
+                        uint32_t& value)
+{
+    text = text.substr(0, maxDigits);
+
+    // Unlike std::from_chars, a leading minus sign is not a digit.
+    if (text.empty() || !std::isdigit(static_cast<unsigned char>(text[0])))
+    {
+        return 0;
+    }
+
+    auto result = std::from_chars(text.data(), text.data() + text.size(), 
+                                  value);
+    return static_cast<size_t>(result.ptr - text.data());
+}
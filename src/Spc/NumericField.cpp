@@ -16,6 +16,9 @@
 
 #include "Spc/NumericField.h"
 
+#include <algorithm>
+#include "Spc/NumberFormat.h"
+
 using namespace Spc;
 
 bool NumericField::IsZero() const
@@ -55,8 +58,8 @@ int32_t NumericField::DetectInt32() const
     }
     else if (IsText())
     {
-        return std::stoi(
-            Binary::RawField::ToString(Binary::StringFormat::Terminated));
+        const char* end = std::find(rawData.get(), rawData.get() + size, 0);
+        return ParseInt32(std::string_view(rawData.get(), end - rawData.get()));
     }
     else
     {
@@ -109,36 +112,14 @@ std::string NumericField::ToString() const
         return Binary::RawField::ToString(Binary::StringFormat::Terminated);
     }
 
-    Binary::Int32Field value{ Binary::FieldEndianness::Little };
-
-    for (int i = 0; i < size && i < value.Size(); i++)
-    {
-        value.RawData()[i] = rawData[i];
-    }
-
-    return value.ToString();
+    return FormatInteger(ToInt32());
 }
 
 void NumericField::SetInt32(int32_t value)
 {
     if (type == NumericType::Text)
     {
-        std::stringstream stream;
-        stream << value;
-        std::string stringValue{ stream.str() };
-
-        for (int i = 0; i < size; i++)
-        {
-            if (i < stringValue.size())
-            {
-                rawData[i] = stringValue[i];
-            }
-            else
-            {
-                rawData[i] = 0;
-            }
-        }
-
+        WriteDigits(value, rawData.get(), size);
         return;
     }
 
@@ -154,22 +135,7 @@ void NumericField::SetUInt32(uint32_t value)
 {
     if (type == NumericType::Text)
     {
-        std::stringstream stream;
-        stream << value;
-        std::string stringValue{ stream.str() };
-
-        for (int i = 0; i < size; i++)
-        {
-            if (i < stringValue.size())
-            {
-                rawData[i] = stringValue[i];
-            }
-            else
-            {
-                rawData[i] = 0;
-            }
-        }
-
+        WriteDigits(value, rawData.get(), size);
         return;
     }
    
@@ -185,7 +151,7 @@ void NumericField::SetValue(const std::string& value)
 {
     if (type == NumericType::Binary || type == NumericType::Either)
     {
-        Binary::Int32Field field{ std::stoi(value) };
+        Binary::Int32Field field{ ParseInt32(value) };
 
         for (int i = 0; i < size && i < field.Size(); i++)
         {
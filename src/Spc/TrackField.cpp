@@ -16,6 +16,7 @@
  
 #include "Spc/TrackField.h"
 #include <stdexcept>
+#include "Spc/NumberFormat.h"
 
 using namespace Spc;
 
@@ -40,21 +41,18 @@ char TrackField::Suffix() const
 
 std::string TrackField::ToString() const
 {
-    std::stringstream stream;
-
-    // Convert first to an int so it is not accidentally interpreted
-    // as an ASCII value when converting to a string. But cast the byte to 
-    // unsigned char first to avoid sign extension issues on certain platforms.
+    // Cast the byte to unsigned char first to avoid sign extension issues on 
+    // certain platforms.
     const unsigned int trackByte = static_cast<unsigned char>(rawData[1]);
 
-    stream << trackByte;
+    std::string value = FormatInteger(trackByte);
 
     if (Suffix() != 0)
     {
-        stream << Suffix();
+        value += Suffix();
     }
 
-    return stream.str();
+    return value;
 }
 
 void TrackField::SetValue(const std::string& value)
@@ -82,7 +80,8 @@ void TrackField::SetValue(const std::string& value)
             "Track value can only contain one suffix character");
     }
 
-    const int trackNo = std::stoi(value.substr(0, numericEnd));
+    const int trackNo = ParseInt32(std::string_view(value).substr(0, 
+                                                                 numericEnd));
     if (trackNo < 0 || trackNo > 99)
     {
         throw std::out_of_range("Track number must be between 0 and 99");
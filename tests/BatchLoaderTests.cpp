@@ -0,0 +1,184 @@
+// BatchLoaderTests.cpp - Defines the BatchLoaderTests class and tests.
+//
+// Copyright (C) 2026 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "BatchLoaderTests.h"
+
+#include <chrono>
+#include <fstream>
+#include <set>
+#include <stdexcept>
+
+void BatchLoaderTests::SetUp()
+{
+    namespace fs = std::filesystem;
+
+    const auto ticks = std::chrono::steady_clock::now().time_since_epoch();
+    tempDir = fs::temp_directory_path() / 
+              ("libcppspc-batch-" + std::to_string(ticks.count()));
+    fs::create_directories(tempDir);
+}
+
+void BatchLoaderTests::TearDown()
+{
+    std::filesystem::remove_all(tempDir);
+}
+
+std::string BatchLoaderTests::CreateTestFile(const std::string& name, 
+                                             const std::string& songTitle)
+{
+    const std::filesystem::path filePath = tempDir / name;
+    std::filesystem::create_directories(filePath.parent_path());
+
+    Spc::File file(filePath.string());
+    Spc::Id666::Tag tag = file.Tag();
+    tag.SetSongTitle(songTitle);
+    file.Save();
+
+    return filePath.string();
+}
+
+std::string BatchLoaderTests::CreateCorruptFile(const std::string& name)
+{
+    const std::filesystem::path filePath = tempDir / name;
+    std::ofstream file(filePath, std::ios::binary);
+    file << "not an spc file";
+
+    return filePath.string();
+}
+
+TEST_F(BatchLoaderTests, DefaultsToAtLeastOneWorker)
+{
+    Spc::BatchLoader loader;
+
+    EXPECT_GE(loader.Workers(), 1);
+    EXPECT_EQ(loader.Mode(), Spc::LoadMode::Buffered);
+    EXPECT_EQ(Spc::BatchLoader(3, Spc::LoadMode::Metadata).Workers(), 3);
+}
+
+TEST_F(BatchLoaderTests, KeepsErrorsSeparatePerFile)
+{
+    const std::vector<std::string> paths
+    {
+        CreateTestFile("first.spc", "First"),
+        CreateCorruptFile("corrupt.spc"),
+        (tempDir / "missing.spc").string(),
+        CreateTestFile("second.spc", "Second")
+    };
+
+    Spc::BatchLoader loader{ 2 };
+    std::vector<Spc::BatchResult> results = loader.Load(paths);
+
+    ASSERT_EQ(results.size(), paths.size());
+
+    for (size_t i = 0; i < paths.size(); i++)
+    {
+        EXPECT_EQ(results[i].path, paths[i]);
+    }
+
+    ASSERT_TRUE(results[0].Succeeded());
+    EXPECT_EQ(results[0].file->Tag().SongTitle().Value(), "First");
+
+    EXPECT_FALSE(results[1].Succeeded());
+    EXPECT_EQ(results[1].file, nullptr);
+    EXPECT_THROW(std::rethrow_exception(results[1].error), 
+                 Spc::FileCorruptException);
+
+    EXPECT_FALSE(results[2].Succeeded());
+    EXPECT_THROW(std::rethrow_exception(results[2].error), 
+                 Spc::FileOperationException);
+
+    ASSERT_TRUE(results[3].Succeeded());
+    EXPECT_EQ(results[3].file->Tag().SongTitle().Value(), "Second");
+}
+
+TEST_F(BatchLoaderTests, CallsBackOnceForEveryFile)
+{
+    std::vector<std::string> paths;
+
+    for (int i = 0; i < 24; i++)
+    {
+        paths.push_back(CreateTestFile(std::to_string(i) + ".spc", 
+                                       std::to_string(i)));
+    }
+
+    Spc::BatchLoader loader{ 4 };
+    std::set<std::string> loaded;
+    size_t calls{ 0 };
+
+    loader.Load(paths, [&](Spc::BatchResult result)
+    {
+        calls++;
+        ASSERT_TRUE(result.Succeeded());
+        loaded.insert(result.file->Tag().SongTitle().Value());
+    });
+
+    EXPECT_EQ(calls, paths.size());
+    EXPECT_EQ(loaded.size(), paths.size());
+}
+
+TEST_F(BatchLoaderTests, RethrowsCallbackErrors)
+{
+    std::vector<std::string> paths;
+
+    for (int i = 0; i < 8; i++)
+    {
+        paths.push_back(CreateTestFile(std::to_string(i) + ".spc", "Song"));
+    }
+
+    Spc::BatchLoader loader{ 4 };
+    size_t calls{ 0 };
+
+    EXPECT_THROW(loader.Load(paths, [&](Spc::BatchResult)
+    {
+        calls++;
+        throw std::runtime_error("Stop.");
+    }), std::runtime_error);
+
+    EXPECT_EQ(calls, 1);
+}
+
+TEST_F(BatchLoaderTests, FindsSpcFilesInDirectory)
+{
+    const std::string first = CreateTestFile("a.spc", "A");
+    const std::string second = CreateTestFile("B.SPC", "B");
+    const std::string nested = CreateTestFile("sub/c.spc", "C");
+    CreateCorruptFile("notes.txt");
+
+    EXPECT_EQ(Spc::BatchLoader::FindFiles(tempDir.string(), false),
+              (std::vector<std::string>{ second, first }));
+    EXPECT_EQ(Spc::BatchLoader::FindFiles(tempDir.string(), true),
+              (std::vector<std::string>{ second, first, nested }));
+    EXPECT_THROW(Spc::BatchLoader::FindFiles((tempDir / "none").string(), 
+                                             false),
+                 Spc::FileOperationException);
+}
+
+TEST_F(BatchLoaderTests, LoadsDirectory)
+{
+    CreateTestFile("a.spc", "A");
+    CreateTestFile("sub/b.spc", "B");
+
+    Spc::BatchLoader loader{ 2 };
+    std::set<std::string> loaded;
+
+    loader.LoadDirectory(tempDir.string(), true, [&](Spc::BatchResult result)
+    {
+        ASSERT_TRUE(result.Succeeded());
+        loaded.insert(result.file->Tag().SongTitle().Value());
+    });
+
+    EXPECT_EQ(loaded, (std::set<std::string>{ "A", "B" }));
+}
@@ -0,0 +1,77 @@
+// ByteCursorTests.cpp - Defines the ByteCursorTests tests.
+//
+// Copyright (C) 2026 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "ByteCursorTests.h"
+
+void ByteCursorTests::SetUp()
+{
+    // No setup needed for these tests.
+}
+
+TEST_F(ByteCursorTests, ReadsLittleEndianIntegers)
+{
+    const char bytes[]{ '\x01', '\x02', '\x03', '\x04', '\x05', '\x06', '\x07' };
+    Spc::ByteCursor cursor{ Spc::ByteView{ bytes, sizeof(bytes) } };
+
+    EXPECT_EQ(cursor.ReadUInt8(), 0x01);
+    EXPECT_EQ(cursor.ReadUInt16(), 0x0302);
+    EXPECT_EQ(cursor.ReadUInt32(), 0x07060504u);
+    EXPECT_EQ(cursor.Position(), sizeof(bytes));
+    EXPECT_EQ(cursor.Remaining(), 0);
+}
+
+TEST_F(ByteCursorTests, ReadsViewsAndCopies)
+{
+    const char bytes[]{ 'x', 'i', 'd', '6', 'a', 'b' };
+    Spc::ByteCursor cursor{ Spc::ByteView{ bytes, sizeof(bytes) } };
+
+    Spc::ByteView id = cursor.Read(4);
+    char copy[2]{};
+    cursor.CopyTo(copy, sizeof(copy));
+
+    EXPECT_EQ(std::string(id.begin(), id.end()), "xid6");
+    EXPECT_EQ(copy[0], 'a');
+    EXPECT_EQ(copy[1], 'b');
+}
+
+TEST_F(ByteCursorTests, SeeksAndSkips)
+{
+    const char bytes[]{ '\x00', '\x01', '\x02', '\x03' };
+    Spc::ByteCursor cursor{ Spc::ByteView{ bytes, sizeof(bytes) } };
+
+    cursor.Seek(3);
+    EXPECT_EQ(cursor.ReadUInt8(), 0x03);
+
+    cursor.Seek(0);
+    cursor.Skip(2);
+    EXPECT_EQ(cursor.Position(), 2);
+    EXPECT_EQ(cursor.Remaining(), 2);
+}
+
+TEST_F(ByteCursorTests, ThrowsWhenReadingPastTheEnd)
+{
+    const char bytes[]{ '\x00', '\x01', '\x02' };
+    Spc::ByteCursor cursor{ Spc::ByteView{ bytes, sizeof(bytes) } };
+
+    EXPECT_THROW(cursor.ReadUInt32(), Spc::FileCorruptException);
+    EXPECT_THROW(cursor.Seek(4), Spc::FileCorruptException);
+    EXPECT_THROW(cursor.Skip(4), Spc::FileCorruptException);
+
+    // A failed read must not move the cursor.
+    EXPECT_EQ(cursor.Position(), 0);
+    EXPECT_EQ(cursor.ReadUInt16(), 0x0100);
+    EXPECT_THROW(cursor.Read(2), Spc::FileCorruptException);
+}
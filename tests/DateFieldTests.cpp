@@ -181,4 +181,36 @@ TEST_F(DateFieldTests, ValueReturnsCorrectBinaryRepresentation)
 
     EXPECT_EQ("02/06/2000", dateField->Value())
         << "Value() should return the correct binary representation";
-}
\ No newline at end of file
+}
+
+TEST_F(DateFieldTests, SetsAndGetsTextDateProperly)
+{
+    dateField->SetType(Spc::NumericType::Text);
+    dateField->SetDate(Spc::Date{ 2000, 2, 6 });
+
+    EXPECT_EQ(dateField->Value(), "02/06/2000");
+    EXPECT_EQ(dateField->ToDate(), (Spc::Date{ 2000, 2, 6 }));
+}
+
+TEST_F(DateFieldTests, SetsAndGetsBinaryDateProperly)
+{
+    dateField->SetType(Spc::NumericType::Binary);
+    dateField->SetDate(Spc::Date{ 2000, 2, 6 });
+
+    EXPECT_FALSE(dateField->IsText());
+    EXPECT_EQ(dateField->Value(), "02/06/2000");
+    EXPECT_EQ(dateField->ToDate(), (Spc::Date{ 2000, 2, 6 }));
+}
+
+TEST_F(DateFieldTests, GetsUnsetDateAsEmpty)
+{
+    EXPECT_FALSE(dateField->ToDate().has_value());
+}
+
+TEST_F(DateFieldTests, RejectsInvalidDates)
+{
+    EXPECT_THROW(dateField->SetDate(Spc::Date{ 2023, 2, 29 }), 
+                 std::invalid_argument);
+    EXPECT_THROW(dateField->SetValue("02/30/2000"), std::invalid_argument);
+    EXPECT_FALSE(dateField->IsSet());
+}
@@ -0,0 +1,63 @@
+// DateTests.cpp - Defines the DateTests class and tests.
+//
+// Copyright (C) 2026 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "DateTests.h"
+
+void DateTests::SetUp()
+{
+    // No setup needed for these tests.
+}
+
+TEST_F(DateTests, DeterminesValidityProperly)
+{
+    EXPECT_TRUE((Spc::Date{ 2000, 2, 6 }.IsValid()));
+    EXPECT_TRUE((Spc::Date{ 2000, 2, 29 }.IsValid()));
+    EXPECT_TRUE((Spc::Date{ 2024, 2, 29 }.IsValid()));
+    EXPECT_TRUE((Spc::Date{ 1999, 12, 31 }.IsValid()));
+    EXPECT_FALSE((Spc::Date{ 1900, 2, 29 }.IsValid()));
+    EXPECT_FALSE((Spc::Date{ 2023, 2, 29 }.IsValid()));
+    EXPECT_FALSE((Spc::Date{ 2000, 4, 31 }.IsValid()));
+    EXPECT_FALSE((Spc::Date{ 2000, 0, 1 }.IsValid()));
+    EXPECT_FALSE((Spc::Date{ 2000, 13, 1 }.IsValid()));
+    EXPECT_FALSE((Spc::Date{ 2000, 1, 0 }.IsValid()));
+    EXPECT_FALSE((Spc::Date{ 10000, 1, 1 }.IsValid()));
+    EXPECT_FALSE(Spc::Date{}.IsValid());
+}
+
+TEST_F(DateTests, FormatsProperly)
+{
+    EXPECT_EQ((Spc::Date{ 2000, 2, 6 }.ToString()), "02/06/2000");
+    EXPECT_EQ((Spc::Date{ 995, 12, 31 }.ToString()), "12/31/0995");
+}
+
+TEST_F(DateTests, ParsesProperly)
+{
+    EXPECT_EQ(Spc::Date::Parse("02/06/2000"), (Spc::Date{ 2000, 2, 6 }));
+    EXPECT_EQ(Spc::Date::Parse("2/6/2000"), (Spc::Date{ 2000, 2, 6 }));
+    EXPECT_EQ(Spc::Date::Parse("02/06/2000 \n"), (Spc::Date{ 2000, 2, 6 }));
+}
+
+TEST_F(DateTests, RejectsInvalidText)
+{
+    EXPECT_FALSE(Spc::Date::Parse("").has_value());
+    EXPECT_FALSE(Spc::Date::Parse("12312025").has_value());
+    EXPECT_FALSE(Spc::Date::Parse("MM/DD/YYYY").has_value());
+    EXPECT_FALSE(Spc::Date::Parse("02/06/2000xyz").has_value());
+    EXPECT_FALSE(Spc::Date::Parse("02/06/").has_value());
+    EXPECT_FALSE(Spc::Date::Parse("02/30/2000").has_value());
+    EXPECT_FALSE(Spc::Date::Parse("13/01/2000").has_value());
+    EXPECT_FALSE(Spc::Date::Parse("123/01/2000").has_value());
+}
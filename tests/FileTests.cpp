@@ -16,10 +16,14 @@
 
 #include "FileTests.h"
 
+#include <algorithm>
 #include <chrono>
 #include <cstring>
 #include <filesystem>
 #include <fstream>
+#include <iterator>
+#include <thread>
+#include <vector>
 
 constexpr size_t headerSize{ 4 };
 constexpr size_t intSize{ 4 };
@@ -165,36 +169,27 @@ void FileTests::MockNonExtendedDataWrites()
     MockBufferStreamWrite(&expectedExtraRam);
 }
 
+void FileTests::MockItemRead(uint8_t id, 
+                             uint8_t type, 
+                             uint16_t data, 
+                             std::string payload)
+{
+    mockedChunk.push_back(static_cast<char>(id));
+    mockedChunk.push_back(static_cast<char>(type));
+    mockedChunk.push_back(static_cast<char>(data & 0xFF));
+    mockedChunk.push_back(static_cast<char>(data >> 8));
+    mockedChunk.insert(mockedChunk.end(), payload.begin(), payload.end());
+}
+
 void FileTests::MockStringRead(uint8_t id, std::string expectedValue)
 {
-    EXPECT_CALL(*mockFileStream, Read(testing::A<Binary::DataStructure&>()))
-        .WillOnce(testing::Invoke([id, expectedValue](Binary::DataStructure& structure)
-        {
-            auto item = static_cast<Spc::Id666::Extended::Item*>(&structure);
-            item->id->SetUInt32(id);
-            item->type->SetUInt32(Spc::Id666::Extended::stringType);
-            item->data->SetUInt32(
-                static_cast<uint32_t>(expectedValue.size()));
-        }));
-    EXPECT_CALL(*mockFileStream, Read(testing::A<Binary::DataField&>()))
-        .WillOnce(testing::Invoke([expectedValue](
-            Binary::DataField& field)
-        {
-            std::memset(field.RawData(), 0, field.Size());
-            std::memcpy(field.RawData(),
-                        expectedValue.c_str(),
-                        expectedValue.size());
-        }));
+    std::string payload = expectedValue;
+    payload.append(PaddingSize(expectedValue), '\0');
 
-    if (NeedsPadding(expectedValue.size()))
-    {
-        EXPECT_CALL(*mockFileStream, Read(testing::A<Binary::DataField&>()))
-            .WillOnce(testing::Invoke([](
-                Binary::DataField& field)
-            {
-                std::memset(field.RawData(), 0, field.Size());
-            }));
-    }
+    MockItemRead(id, 
+                 Spc::Id666::Extended::stringType, 
+                 static_cast<uint16_t>(expectedValue.size()), 
+                 payload);
 }
 
 void FileTests::MockStringWrite(uint8_t id, std::string value)
@@ -256,15 +251,10 @@ void FileTests::MockLongTagValueWrites()
 
 void FileTests::MockLengthRead(uint8_t id, Spc::NumericField expectedField)
 {
-    EXPECT_CALL(*mockFileStream, Read(testing::A<Binary::DataStructure&>()))
-        .WillOnce(testing::Invoke([id, expectedField](
-            Binary::DataStructure& structure)
-        {
-            auto item = static_cast<Spc::Id666::Extended::Item*>(&structure);
-            item->id->SetUInt32(id);
-            item->type->SetUInt32(Spc::Id666::Extended::lengthType);
-            item->data->SetUInt32(expectedField.ToUInt32());
-        }));
+    MockItemRead(id, 
+                 Spc::Id666::Extended::lengthType, 
+                 static_cast<uint16_t>(expectedField.ToUInt32()), 
+                 "");
 }
 
 void FileTests::MockLengthWrite(uint8_t id, Spc::NumericField field)
@@ -283,21 +273,18 @@ void FileTests::MockLengthWrite(uint8_t id, Spc::NumericField field)
 
 void FileTests::MockIntRead(uint8_t id, Spc::NumericField expectedField)
 {
-    EXPECT_CALL(*mockFileStream, Read(testing::A<Binary::DataStructure&>()))
-        .WillOnce(testing::Invoke([id](Binary::DataStructure& structure)
-        {
-            auto item = static_cast<Spc::Id666::Extended::Item*>(&structure);
-            item->id->SetUInt32(id);
-            item->type->SetUInt32(Spc::Id666::Extended::integerType);
-            item->data->SetUInt32(intSize);
-        }));
-    EXPECT_CALL(*mockFileStream, Read(testing::A<Binary::DataField&>()))
-        .WillOnce(testing::Invoke([expectedField](
-            Binary::DataField& field)
-        {
-            auto introField = static_cast<Spc::NumericField*>(&field);
-            introField->SetUInt32(expectedField.ToUInt32());
-        }));
+    const uint32_t value = expectedField.ToUInt32();
+    std::string payload;
+
+    for (size_t i = 0; i < intSize; i++)
+    {
+        payload.push_back(static_cast<char>(value >> (i * 8)));
+    }
+
+    MockItemRead(id, 
+                 Spc::Id666::Extended::integerType, 
+                 static_cast<uint16_t>(intSize), 
+                 payload);
 }
 
 void FileTests::MockIntWrite(uint8_t id, Spc::NumericField field)
@@ -327,17 +314,15 @@ void FileTests::MockExtendedTagValueReads()
     MockStringRead(Spc::Id666::Extended::ostTitleInfo.id, expectedOstTitle);
     MockLengthRead(Spc::Id666::Extended::ostDiscInfo.id, expectedTag.OstDisc());
 
-    // Do not use the generic MockLengthRead here as we need the specialty
-    // Spc::TrackField for the track to set properly. 
-    EXPECT_CALL(*mockFileStream, Read(testing::A<Binary::DataStructure&>()))
-        .WillOnce(testing::Invoke([ostTrack = expectedTag.OstTrack()](
-            Binary::DataStructure& structure) mutable
-        {
-            auto item = static_cast<Spc::Id666::Extended::Item*>(&structure);
-            item->id->SetUInt32(Spc::Id666::Extended::ostTrackInfo.id);
-            item->type->SetUInt32(Spc::Id666::Extended::lengthType);
-            ostTrack.CopyRawDataTo(*item->data);
-        }));
+    // Do not use the generic MockLengthRead here as the track is stored as
+    // the raw bytes of the specialty Spc::TrackField.
+    Spc::TrackField ostTrack = expectedTag.OstTrack();
+    MockItemRead(Spc::Id666::Extended::ostTrackInfo.id,
+                 Spc::Id666::Extended::lengthType,
+                 static_cast<uint16_t>(
+                     static_cast<uint8_t>(ostTrack.RawData()[0]) | 
+                     static_cast<uint8_t>(ostTrack.RawData()[1]) << 8),
+                 "");
 
     MockStringRead(Spc::Id666::Extended::publisherNameInfo.id, 
                    expectedPublisherName);
@@ -352,15 +337,8 @@ void FileTests::MockExtendedTagValueReads()
     MockLengthRead(Spc::Id666::Extended::loopTimesInfo.id, 
                    expectedTag.LoopTimes());
     
-    EXPECT_CALL(*mockFileStream, Read(testing::A<Binary::DataStructure&>()))
-        .WillOnce(testing::Invoke([muted = expectedTag.MutedVoices()](
-            Binary::DataStructure& structure)
-        {
-            auto item = static_cast<Spc::Id666::Extended::Item*>(&structure);
-            item->id->SetUInt32(Spc::Id666::Extended::mutedVoicesInfo.id);
-            item->type->SetUInt32(Spc::Id666::Extended::lengthType);
-            item->data->SetUInt32(muted.ToUInt32());
-        }));
+    MockLengthRead(Spc::Id666::Extended::mutedVoicesInfo.id, 
+                   expectedTag.MutedVoices());
 
     MockIntRead(Spc::Id666::Extended::preampLevelInfo.id, 
                 expectedTag.PreampLevel());
@@ -370,6 +348,15 @@ void FileTests::MockFileReads(bool useLongTagValues)
 {
     size_t expectedChunkSize = CalculateExpectedChunkSize(useLongTagValues);
 
+    mockedChunk.clear();
+
+    if (useLongTagValues)
+    {
+        MockLongTagValueReads();
+    }
+
+    MockExtendedTagValueReads();
+
     {
         testing::InSequence sequence;
 
@@ -385,12 +372,21 @@ void FileTests::MockFileReads(bool useLongTagValues)
                 return header;
             }));
 
-        if (useLongTagValues)
-        {
-            MockLongTagValueReads();
-        }
-
-        MockExtendedTagValueReads();
+        // The whole chunk is read at once, so the mocked items are copied to
+        // the buffer the file reads into.
+        const size_t chunkOffset = Spc::Id666::Extended::dataOffset + 8;
+        EXPECT_CALL(*mockFileStream, Position())
+            .WillOnce(testing::Return(chunkOffset));
+        EXPECT_CALL(*mockFileStream, End())
+            .WillOnce(testing::Return(chunkOffset + mockedChunk.size()));
+        EXPECT_CALL(*mockFileStream, Read(testing::A<Binary::DataField&>()))
+            .WillOnce(testing::Invoke([this](Binary::DataField& field)
+            {
+                ASSERT_EQ(field.Size(), mockedChunk.size());
+                std::memcpy(field.RawData(), 
+                            mockedChunk.data(), 
+                            mockedChunk.size());
+            }));
 
         EXPECT_CALL(*mockFileStream, Close());
     }
@@ -398,44 +394,65 @@ void FileTests::MockFileReads(bool useLongTagValues)
 
 void FileTests::MockFileWrites()
 {
-    const auto expectedExtendedData = expectedTag.ExtendedData();
-    const auto expectedChunkSize = expectedExtendedData->Size();
-
     {
         testing::InSequence sequence;
 
         MockNonExtendedDataWrites();
+        MockExtendedDataWrites();
+        EXPECT_CALL(*mockFileStream, Close());
+    }
+}
 
-        EXPECT_CALL(*mockFileStream, 
-                    Write(testing::A<const Binary::DataStructure&>()))
-            .WillOnce(testing::Invoke([expectedChunkSize](
-                const Binary::DataStructure& structure)
-            {
-                auto header = static_cast<const Binary::ChunkHeader*>(&structure);
-                auto expectedHeader = std::make_shared<Binary::ChunkHeader>();
-                expectedHeader->id.SetValue("xid6");
-                expectedHeader->dataSize.SetValue(
-                    static_cast<uint32_t>(expectedChunkSize));
-                EXPECT_EQ(header->id.Value(), expectedHeader->id.Value());
-                EXPECT_EQ(header->dataSize.Value(), 
-                          expectedHeader->dataSize.Value());
-            }));
+void FileTests::MockExtendedDataWrites()
+{
+    const auto expectedExtendedData = expectedTag.ExtendedData();
+    const auto expectedChunkSize = expectedExtendedData->Size();
+    const auto expectedItems = Spc::Id666::Extended::ItemTable::FromData(
+        *expectedExtendedData);
 
-        EXPECT_CALL(*mockFileStream,
-                    Write(testing::A<const Binary::DataStructure&>()))
-            .WillOnce(testing::Invoke([expectedExtendedData](
-                const Binary::DataStructure& structure)
+    // The chunk header and every item are written together in one write.
+    EXPECT_CALL(*mockFileStream, Write(testing::A<const Binary::DataField&>()))
+        .WillOnce(testing::Invoke([expectedChunkSize, expectedItems](
+            const Binary::DataField& field)
+        {
+            const size_t headerSize = Spc::Id666::Extended::chunkHeaderSize;
+            ASSERT_EQ(field.Size(), headerSize + expectedChunkSize);
+            EXPECT_EQ(std::string(field.RawData(), 4), "xid6");
+
+            Spc::ByteCursor cursor{ 
+                Spc::ByteView{ field.RawData(), field.Size() } };
+            cursor.Skip(4);
+            EXPECT_EQ(cursor.ReadUInt32(), expectedChunkSize);
+
+            for (Spc::Id666::Extended::ItemView item : expectedItems)
             {
-                auto extendedData =
-                    static_cast<const Spc::Id666::Extended::Data*>(&structure);
-
-                EXPECT_EQ(extendedData->Header().id.Value(),
-                          expectedExtendedData->Header().id.Value());
-                EXPECT_EQ(extendedData->Header().dataSize.Value(),
-                          expectedExtendedData->Header().dataSize.Value());
-                EXPECT_EQ(extendedData->Size(), expectedExtendedData->Size());
-            }));
+                EXPECT_EQ(cursor.ReadUInt8(), item.id);
+                EXPECT_EQ(cursor.ReadUInt8(), item.type);
+                EXPECT_EQ(cursor.ReadUInt16(), item.data);
+
+                Spc::ByteView payload = cursor.Read(item.payload.Size());
+                EXPECT_TRUE(std::equal(payload.begin(), 
+                                       payload.end(), 
+                                       item.payload.begin()));
+                cursor.Skip(item.padding.Size());
+            }
+        }));
+}
+
+void FileTests::MockTagPatchWrites()
+{
+    {
+        testing::InSequence sequence;
 
+        EXPECT_CALL(*mockFileStream, Open(Binary::FileMode::ReadWrite));
+        EXPECT_CALL(*mockFileStream, IsOpen()).WillOnce(testing::Return(true));
+        EXPECT_CALL(*mockFileStream, FileSize())
+            .WillOnce(testing::Return(Spc::Id666::Extended::dataOffset));
+        EXPECT_CALL(*mockFileStream, SetPosition(Spc::Id666::tagOffset));
+        MockBufferStreamWrite(expectedTag.FieldData().get());
+        EXPECT_CALL(*mockFileStream, 
+                    SetPosition(Spc::Id666::Extended::dataOffset));
+        MockExtendedDataWrites();
         EXPECT_CALL(*mockFileStream, Close());
     }
 }
@@ -618,11 +635,46 @@ void FileTests::TestFileLoadsAndSavesProperly(bool useLongTagValues)
     expectedTag = tag;
     file.SetTag(tag);
 
-    MockFileWrites();
+    // Only the tag and extended data changed since the file was loaded, so
+    // those are the only parts that should be written back.
+    MockTagPatchWrites();
+
+    file.Save();
+}
+
+std::filesystem::path FileTests::CreateTempDirectory() const
+{
+    namespace fs = std::filesystem;
+
+    const std::string uniqueDirName =
+        "LibCppSpc_FileTests_" +
+        std::to_string(std::chrono::steady_clock::now()
+                           .time_since_epoch()
+                           .count());
+    const fs::path tempDir = fs::temp_directory_path() / uniqueDirName;
+    fs::create_directories(tempDir);
+    return tempDir;
+}
 
+void FileTests::CreateTestFile(const std::filesystem::path& filePath)
+{
+    Spc::File file(filePath.string());
+    file.SetHeader(expectedHeader);
+    file.SetTag(expectedTag);
+    file.SetRam(expectedRam);
+    file.SetDspRegisters(expectedDspRegisters);
+    file.SetUnused(expectedUnused);
+    file.SetExtraRam(expectedExtraRam);
     file.Save();
 }
 
+void FileTests::TestViewMatches(Spc::ByteView view, 
+                                const Binary::BufferStream& expected)
+{
+    ASSERT_EQ(view.Size(), expected.Size());
+    EXPECT_EQ(std::memcmp(view.Data(), expected.RawData(), view.Size()), 0);
+}
+
 bool AllBytesMatch(const Binary::DataField* expected,
                    const Binary::DataField* actual)
 {
@@ -898,6 +950,52 @@ TEST_F(FileTests, ConvertsFilenameToTagProperly)
     EXPECT_EQ(tag.OstTrack().Value(), "10");
 }
 
+TEST_F(FileTests, ConvertsFilenameToTagWhenTitleContainsSeparator)
+{
+    Spc::File file("Game - Part 2 - 10.spc", mockFileStream);
+
+    // Mock the file operations that occur during Save()
+    ON_CALL(*mockFileStream, Open(testing::_))
+        .WillByDefault(testing::Return());
+    ON_CALL(*mockFileStream, IsOpen())
+        .WillByDefault(testing::Return(true));
+    ON_CALL(*mockFileStream, Write(testing::A<const Binary::DataField&>()))
+        .WillByDefault(testing::Return());
+    ON_CALL(*mockFileStream, Close())
+        .WillByDefault(testing::Return());
+
+    bool success = file.FileNameToTag("%game% - %track%.spc");
+
+    Spc::Id666::Tag tag = file.Tag();
+    EXPECT_TRUE(success);
+    EXPECT_EQ(tag.GameTitle().Value(), "Game - Part 2");
+    EXPECT_EQ(tag.OstTrack().Value(), "10");
+}
+
+TEST_F(FileTests, ConvertsFilenameToTagWithFormattedPlaceholders)
+{
+    Spc::File file("07 - Intro  (1995).spc", mockFileStream);
+
+    // Mock the file operations that occur during Save()
+    ON_CALL(*mockFileStream, Open(testing::_))
+        .WillByDefault(testing::Return());
+    ON_CALL(*mockFileStream, IsOpen())
+        .WillByDefault(testing::Return(true));
+    ON_CALL(*mockFileStream, Write(testing::A<const Binary::DataField&>()))
+        .WillByDefault(testing::Return());
+    ON_CALL(*mockFileStream, Close())
+        .WillByDefault(testing::Return());
+
+    bool success = file.FileNameToTag(
+        "%track:02% - %song:-7%(%year%).spc");
+
+    Spc::Id666::Tag tag = file.Tag();
+    EXPECT_TRUE(success);
+    EXPECT_EQ(tag.OstTrackValue(), 7);
+    EXPECT_EQ(tag.SongTitle().Value(), "Intro");
+    EXPECT_EQ(tag.CopyrightYear().Value(), "1995");
+}
+
 TEST_F(FileTests, ConvertsFilenameToTagProperlyWithLiteralPrefix)
 {
     Spc::File file("AB-Game-10.spc", mockFileStream);
@@ -1014,3 +1112,1047 @@ TEST_F(FileTests, FailsTagToFilenameWhenGeneratedNameContainsPath)
     fs::remove_all(tempDir);
 }
 
+TEST_F(FileTests, ConvertsDateToFilenameWithoutSlashes)
+{
+    namespace fs = std::filesystem;
+
+    const fs::path tempDir = CreateTempDirectory();
+    const fs::path sourcePath = tempDir / "source.spc";
+
+    {
+        std::ofstream sourceFile(sourcePath, std::ios::binary);
+        ASSERT_TRUE(sourceFile.is_open());
+        sourceFile << "spc-test-data";
+    }
+
+    Spc::File file(sourcePath.string());
+    Spc::Id666::Tag tag;
+
+    tag.SetDateDumped("10/17/2026");
+    tag.SetSongTitle("Song");
+    file.SetTag(tag);
+
+    EXPECT_TRUE(file.TagToFileName("%date% %song%.spc"));
+    EXPECT_TRUE(fs::exists(tempDir / "10-17-2026 Song.spc"));
+
+    fs::remove_all(tempDir);
+}
+
+TEST_F(FileTests, CopiesManyFilesWithOneCompiledPattern)
+{
+    namespace fs = std::filesystem;
+
+    const fs::path tempDir = CreateTempDirectory();
+    const Spc::Id666::Pattern::Compiled pattern{ "%game%-%track%.spc" };
+
+    for (int track = 1; track <= 3; track++)
+    {
+        const fs::path sourcePath = 
+            tempDir / ("source" + std::to_string(track) + ".spc");
+
+        {
+            std::ofstream sourceFile(sourcePath, std::ios::binary);
+            ASSERT_TRUE(sourceFile.is_open());
+            sourceFile << "spc-test-data";
+        }
+
+        Spc::File file(sourcePath.string());
+        Spc::Id666::Tag tag;
+
+        tag.SetGameTitle("Test");
+        tag.SetOstTrack(std::to_string(track));
+        file.SetTag(tag);
+
+        EXPECT_TRUE(file.TagToFileName(pattern));
+        EXPECT_TRUE(fs::exists(
+            tempDir / ("Test-" + std::to_string(track) + ".spc")));
+    }
+
+    fs::remove_all(tempDir);
+}
+
+TEST_F(FileTests, CopiesFilesIntoLayoutDirectories)
+{
+    namespace fs = std::filesystem;
+
+    const fs::path tempDir = CreateTempDirectory();
+    Spc::Layout layout{ 
+        Spc::Id666::Pattern::Compiled{ "%game%/%track:02% %song%.spc" }, 
+        tempDir / "sorted" 
+    };
+
+    for (int track = 1; track <= 2; track++)
+    {
+        const fs::path sourcePath = 
+            tempDir / ("source" + std::to_string(track) + ".spc");
+
+        {
+            std::ofstream sourceFile(sourcePath, std::ios::binary);
+            ASSERT_TRUE(sourceFile.is_open());
+            sourceFile << "spc-test-data";
+        }
+
+        Spc::File file(sourcePath.string());
+        Spc::Id666::Tag tag;
+
+        tag.SetGameTitle("Test");
+        tag.SetSongTitle("Song");
+        tag.SetOstTrack(std::to_string(track));
+        file.SetTag(tag);
+
+        EXPECT_TRUE(file.TagToFileName(layout));
+        EXPECT_TRUE(fs::exists(tempDir / "sorted" / "Test" / 
+                               ("0" + std::to_string(track) + " Song.spc")));
+
+        // The copy is never overwritten.
+        EXPECT_FALSE(file.TagToFileName(layout));
+    }
+
+    fs::remove_all(tempDir);
+}
+
+TEST_F(FileTests, TransfersFileWithEachMode)
+{
+    namespace fs = std::filesystem;
+
+    const fs::path tempDir = CreateTempDirectory();
+    const Spc::TransferMode modes[]{ Spc::TransferMode::Copy, 
+                                     Spc::TransferMode::Move,
+                                     Spc::TransferMode::HardLink,
+                                     Spc::TransferMode::Clone };
+
+    for (Spc::TransferMode mode : modes)
+    {
+        const std::string name = std::to_string(static_cast<int>(mode));
+        const fs::path sourcePath = tempDir / ("source" + name + ".spc");
+        const fs::path destinationPath = tempDir / ("Test-" + name + ".spc");
+
+        {
+            std::ofstream sourceFile(sourcePath, std::ios::binary);
+            ASSERT_TRUE(sourceFile.is_open());
+            sourceFile << "spc-test-data";
+        }
+
+        Spc::File file(sourcePath.string());
+        Spc::Id666::Tag tag;
+
+        tag.SetGameTitle("Test");
+        tag.SetOstTrack(name);
+        file.SetTag(tag);
+
+        EXPECT_TRUE(file.TagToFileName("%game%-%track%.spc", mode));
+        EXPECT_EQ(fs::file_size(destinationPath), 13);
+        EXPECT_EQ(fs::exists(sourcePath), mode != Spc::TransferMode::Move);
+        EXPECT_EQ(fs::hard_link_count(destinationPath), 
+                  mode == Spc::TransferMode::HardLink ? 2 : 1);
+
+        if (mode == Spc::TransferMode::Move)
+        {
+            EXPECT_EQ(file.Path(), destinationPath.string());
+        }
+        else
+        {
+            EXPECT_EQ(file.Path(), sourcePath.string());
+        }
+    }
+
+    fs::remove_all(tempDir);
+}
+
+TEST_F(FileTests, SavesToNewPathAfterMove)
+{
+    namespace fs = std::filesystem;
+
+    const fs::path tempDir = CreateTempDirectory();
+    const fs::path sourcePath = tempDir / "source.spc";
+    const fs::path movedPath = tempDir / "Song.spc";
+    CreateTestFile(sourcePath);
+
+    Spc::File file(sourcePath.string());
+    file.Load();
+
+    Spc::Id666::Tag tag = file.Tag();
+    tag.SetSongTitle("Song");
+    file.SetTag(tag);
+
+    ASSERT_TRUE(file.TagToFileName("%song%.spc", Spc::TransferMode::Move));
+
+    tag.SetGameTitle("Saved After Move");
+    file.SetTag(tag);
+    file.Save();
+
+    Spc::File moved(movedPath.string());
+    moved.Load();
+
+    EXPECT_FALSE(fs::exists(sourcePath));
+    EXPECT_EQ(moved.Tag().GameTitle().Value(), "Saved After Move");
+
+    fs::remove_all(tempDir);
+}
+
+TEST_F(FileTests, RejectsMoveWithInjectedStream)
+{
+    Spc::File file("Test-10.spc", mockFileStream);
+
+    EXPECT_FALSE(file.TagToFileName("%game%.spc", Spc::TransferMode::Move));
+    EXPECT_EQ(file.Path(), "Test-10.spc");
+}
+
+TEST_F(FileTests, NeverReplacesExistingFileWhenTransferring)
+{
+    namespace fs = std::filesystem;
+
+    const fs::path tempDir = CreateTempDirectory();
+    const fs::path sourcePath = tempDir / "source.spc";
+    const fs::path existingPath = tempDir / "Test.spc";
+
+    {
+        std::ofstream sourceFile(sourcePath, std::ios::binary);
+        std::ofstream existingFile(existingPath, std::ios::binary);
+        sourceFile << "spc-test-data";
+        existingFile << "existing";
+    }
+
+    Spc::File file(sourcePath.string());
+    Spc::Id666::Tag tag;
+
+    tag.SetGameTitle("Test");
+    file.SetTag(tag);
+
+    for (Spc::TransferMode mode : { Spc::TransferMode::Copy, 
+                                    Spc::TransferMode::Move,
+                                    Spc::TransferMode::HardLink,
+                                    Spc::TransferMode::Clone })
+    {
+        EXPECT_FALSE(file.TagToFileName("%game%.spc", mode));
+        EXPECT_EQ(fs::file_size(existingPath), 8);
+        EXPECT_TRUE(fs::exists(sourcePath));
+        EXPECT_EQ(file.Path(), sourcePath.string());
+    }
+
+    fs::remove_all(tempDir);
+}
+
+
+TEST_F(FileTests, LoadsMappedFileProperly)
+{
+    namespace fs = std::filesystem;
+
+    const fs::path tempDir = CreateTempDirectory();
+    const fs::path filePath = tempDir / "mapped.spc";
+    CreateTestFile(filePath);
+
+    Spc::File file(filePath.string());
+    file.Load(Spc::LoadMode::Mapped);
+
+    EXPECT_TRUE(file.IsMapped());
+    EXPECT_EQ(file.Header().id.Value(), Spc::headerId);
+    EXPECT_EQ(file.Tag().SongTitle().Value(), expectedSongTitle);
+    EXPECT_EQ(file.Tag().OstTitle().Value(), expectedOstTitle);
+    EXPECT_EQ(file.Tag().PreampLevel().Value(), expectedPreampLevel);
+    TestViewMatches(file.RamView(), expectedRam);
+    TestViewMatches(file.DspRegistersView(), expectedDspRegisters);
+    TestViewMatches(file.UnusedView(), expectedUnused);
+    TestViewMatches(file.ExtraRamView(), expectedExtraRam);
+    TestViewMatches(file.TagView(), *expectedTag.FieldData());
+
+    Binary::BufferStream ram = file.Ram();
+    EXPECT_TRUE(AllBytesMatch(&expectedRam, &ram));
+
+    fs::remove_all(tempDir);
+}
+
+TEST_F(FileTests, CopiesMappedSectionsOnceAcrossThreads)
+{
+    namespace fs = std::filesystem;
+
+    const fs::path tempDir = CreateTempDirectory();
+    const fs::path filePath = tempDir / "mapped.spc";
+    CreateTestFile(filePath);
+
+    Spc::File file(filePath.string());
+    file.Load(Spc::LoadMode::Mapped);
+    const Spc::File& mappedFile = file;
+
+    constexpr size_t threadCount = 8;
+    std::vector<const Binary::BufferStream*> rams(threadCount, nullptr);
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < threadCount; i++)
+    {
+        threads.emplace_back([&mappedFile, &rams, i] {
+            rams[i] = &mappedFile.Ram();
+        });
+    }
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    for (auto ram : rams)
+    {
+        EXPECT_EQ(ram, &mappedFile.Ram());
+    }
+
+    Binary::BufferStream ram = mappedFile.Ram();
+    EXPECT_TRUE(AllBytesMatch(&expectedRam, &ram));
+    Binary::BufferStream extraRam = mappedFile.ExtraRam();
+    EXPECT_TRUE(AllBytesMatch(&expectedExtraRam, &extraRam));
+
+    fs::remove_all(tempDir);
+}
+
+TEST_F(FileTests, SavesMappedFileWithoutLosingSections)
+{
+    namespace fs = std::filesystem;
+
+    const fs::path tempDir = CreateTempDirectory();
+    const fs::path filePath = tempDir / "mapped.spc";
+    CreateTestFile(filePath);
+
+    {
+        Spc::File file(filePath.string());
+        file.Load(Spc::LoadMode::Mapped);
+        Spc::Id666::Tag tag = file.Tag();
+        tag.SetSongTitle("Mapped Title");
+        file.SetTag(tag);
+        file.Save();
+
+        EXPECT_FALSE(file.IsMapped());
+        TestViewMatches(file.RamView(), expectedRam);
+    }
+
+    Spc::File file(filePath.string());
+    file.Load();
+
+    EXPECT_EQ(file.Tag().SongTitle().Value(), "Mapped Title");
+    TestViewMatches(file.RamView(), expectedRam);
+    TestViewMatches(file.ExtraRamView(), expectedExtraRam);
+
+    fs::remove_all(tempDir);
+}
+
+TEST_F(FileTests, ThrowsWhenMappedFileIsTruncated)
+{
+    namespace fs = std::filesystem;
+
+    const fs::path tempDir = CreateTempDirectory();
+    const fs::path filePath = tempDir / "truncated.spc";
+
+    {
+        std::ofstream file(filePath, std::ios::binary);
+        file << "spc-test-data";
+    }
+
+    Spc::File file(filePath.string());
+
+    EXPECT_THROW(file.Load(Spc::LoadMode::Mapped), Spc::FileCorruptException);
+    EXPECT_FALSE(file.IsMapped());
+
+    fs::remove_all(tempDir);
+}
+
+TEST_F(FileTests, ReturnsMappedSectionsByReference)
+{
+    namespace fs = std::filesystem;
+
+    const fs::path tempDir = CreateTempDirectory();
+    const fs::path filePath = tempDir / "mapped.spc";
+    CreateTestFile(filePath);
+
+    Spc::File file(filePath.string());
+    file.Load(Spc::LoadMode::Mapped);
+
+    const Binary::BufferStream& ram = file.Ram();
+
+    EXPECT_EQ(&ram, &file.Ram());
+    EXPECT_TRUE(file.IsMapped());
+    EXPECT_TRUE(AllBytesMatch(&expectedRam, &ram));
+    EXPECT_TRUE(AllBytesMatch(&expectedDspRegisters, &file.DspRegisters()));
+    EXPECT_TRUE(AllBytesMatch(&expectedUnused, &file.Unused()));
+    EXPECT_TRUE(AllBytesMatch(&expectedExtraRam, &file.ExtraRam()));
+
+    // Unmapping must keep the sections that were already copied out.
+    file.PatchDspRegisters(0, Spc::ByteView{ "\x7F", 1 });
+    EXPECT_FALSE(file.IsMapped());
+    EXPECT_TRUE(AllBytesMatch(&expectedRam, &file.Ram()));
+
+    fs::remove_all(tempDir);
+}
+
+TEST_F(FileTests, MovesSectionsIntoFile)
+{
+    Spc::File file("test.spc", mockFileStream);
+
+    Spc::Header header{ expectedHeader };
+    Binary::BufferStream ram{ expectedRam };
+    Binary::BufferStream dspRegisters{ expectedDspRegisters };
+    Binary::BufferStream unused{ expectedUnused };
+    Binary::BufferStream extraRam{ expectedExtraRam };
+    Spc::Id666::Tag tag{ expectedTag };
+
+    file.SetHeader(std::move(header));
+    file.SetTag(std::move(tag));
+    file.SetRam(std::move(ram));
+    file.SetDspRegisters(std::move(dspRegisters));
+    file.SetUnused(std::move(unused));
+    file.SetExtraRam(std::move(extraRam));
+
+    EXPECT_EQ(file.Header().id.Value(), expectedHeader.id.Value());
+    EXPECT_EQ(file.Header().SpcFields()[0], &file.Header().id);
+    EXPECT_EQ(file.Tag().SongTitle().Value(), expectedSongTitle);
+    EXPECT_TRUE(AllBytesMatch(&expectedRam, &file.Ram()));
+    EXPECT_TRUE(AllBytesMatch(&expectedDspRegisters, &file.DspRegisters()));
+    EXPECT_TRUE(AllBytesMatch(&expectedUnused, &file.Unused()));
+    EXPECT_TRUE(AllBytesMatch(&expectedExtraRam, &file.ExtraRam()));
+    EXPECT_TRUE(file.IsModified());
+}
+
+TEST_F(FileTests, LoadsMetadataWithoutReadingSections)
+{
+    Spc::File file("test.spc", mockFileStream);
+
+    {
+        testing::InSequence sequence;
+
+        EXPECT_CALL(*mockFileStream, Open(Binary::FileMode::Read));
+        EXPECT_CALL(*mockFileStream, IsOpen()).WillOnce(testing::Return(true));
+        EXPECT_CALL(*mockFileStream, FileSize())
+            .WillOnce(testing::Return(Spc::Id666::Extended::dataOffset));
+        MockHeaderRead();
+        EXPECT_CALL(*mockFileStream, Read(testing::A<Binary::DataField&>()))
+            .WillOnce(testing::Invoke([this](Binary::DataField& field)
+            {
+                std::memcpy(field.RawData(), 
+                            expectedTag.FieldData()->RawData(), 
+                            field.Size());
+            }));
+        EXPECT_CALL(*mockFileStream, 
+                    SetPosition(Spc::Id666::Extended::dataOffset));
+        EXPECT_CALL(*mockFileStream, FindNextChunk("xid6"))
+            .WillOnce(testing::Return(nullptr));
+        EXPECT_CALL(*mockFileStream, Close());
+    }
+
+    file.Load(Spc::LoadMode::Metadata);
+
+    EXPECT_FALSE(file.HasSections());
+    EXPECT_EQ(file.Header().id.Value(), Spc::headerId);
+    EXPECT_EQ(file.Tag().SongTitle().Value(), expectedSongTitle);
+    EXPECT_EQ(file.Tag().GameTitle().Value(), expectedGameTitle);
+}
+
+TEST_F(FileTests, LoadsMetadataFromFileProperly)
+{
+    namespace fs = std::filesystem;
+
+    const fs::path tempDir = CreateTempDirectory();
+    const fs::path filePath = tempDir / "metadata.spc";
+    CreateTestFile(filePath);
+
+    Spc::File file(filePath.string());
+    file.Load(Spc::LoadMode::Metadata);
+
+    EXPECT_EQ(file.Tag().SongTitle().Value(), expectedSongTitle);
+    EXPECT_EQ(file.Tag().OstTitle().Value(), expectedOstTitle);
+    EXPECT_EQ(file.Tag().IntroLength().Value(), expectedIntroLength);
+
+    Spc::Id666::Tag tag = file.Tag();
+    tag.SetSongTitle("Metadata Title");
+    file.Save();
+    file.Load();
+
+    EXPECT_TRUE(file.HasSections());
+    EXPECT_EQ(file.Tag().SongTitle().Value(), "Metadata Title");
+    TestViewMatches(file.RamView(), expectedRam);
+
+    fs::remove_all(tempDir);
+}
+
+TEST_F(FileTests, ThrowsWhenSavingMetadataOnlyFileToBuffer)
+{
+    namespace fs = std::filesystem;
+
+    const fs::path tempDir = CreateTempDirectory();
+    const fs::path filePath = tempDir / "metadata.spc";
+    CreateTestFile(filePath);
+
+    Spc::File file(filePath.string());
+    file.Load(Spc::LoadMode::Metadata);
+
+    std::vector<char> buffer;
+    std::vector<char> fixed(0x20000);
+
+    EXPECT_THROW(file.Save(buffer), Spc::FileOperationException);
+    EXPECT_THROW(file.Save(fixed.data(), fixed.size()), 
+                 Spc::FileOperationException);
+
+    fs::remove_all(tempDir);
+}
+
+TEST_F(FileTests, ThrowsWhenReadingSectionsOfMetadataOnlyFile)
+{
+    namespace fs = std::filesystem;
+
+    const fs::path tempDir = CreateTempDirectory();
+    const fs::path filePath = tempDir / "metadata.spc";
+    CreateTestFile(filePath);
+
+    Spc::File file(filePath.string());
+    file.Load(Spc::LoadMode::Metadata);
+
+    EXPECT_THROW(file.Ram(), Spc::FileOperationException);
+    EXPECT_THROW(file.DspRegisters(), Spc::FileOperationException);
+    EXPECT_THROW(file.Unused(), Spc::FileOperationException);
+    EXPECT_THROW(file.ExtraRam(), Spc::FileOperationException);
+    EXPECT_THROW(file.RamView(), Spc::FileOperationException);
+    EXPECT_THROW(file.DspRegistersView(), Spc::FileOperationException);
+    EXPECT_THROW(file.UnusedView(), Spc::FileOperationException);
+    EXPECT_THROW(file.ExtraRamView(), Spc::FileOperationException);
+
+    fs::remove_all(tempDir);
+}
+
+TEST_F(FileTests, HasSectionsOnceEverySectionIsSet)
+{
+    namespace fs = std::filesystem;
+
+    const fs::path tempDir = CreateTempDirectory();
+    const fs::path filePath = tempDir / "metadata.spc";
+    CreateTestFile(filePath);
+
+    Spc::File file(filePath.string());
+    file.Load(Spc::LoadMode::Metadata);
+    file.SetRam(expectedRam);
+
+    EXPECT_FALSE(file.HasSections());
+    TestViewMatches(file.RamView(), expectedRam);
+    EXPECT_THROW(file.DspRegisters(), Spc::FileOperationException);
+
+    file.SetDspRegisters(expectedDspRegisters);
+    file.SetUnused(expectedUnused);
+    file.SetExtraRam(expectedExtraRam);
+
+    EXPECT_TRUE(file.HasSections());
+    TestViewMatches(file.ExtraRamView(), expectedExtraRam);
+
+    std::vector<char> buffer;
+    EXPECT_NO_THROW(file.Save(buffer));
+
+    file.Load(Spc::LoadMode::Metadata);
+
+    EXPECT_FALSE(file.HasSections());
+    EXPECT_THROW(file.Ram(), Spc::FileOperationException);
+
+    fs::remove_all(tempDir);
+}
+
+TEST_F(FileTests, ClearsExtendedItemsWhenReloadedWithoutChunk)
+{
+    namespace fs = std::filesystem;
+
+    const fs::path tempDir = CreateTempDirectory();
+    const fs::path filePath = tempDir / "reload.spc";
+    const Spc::LoadMode modes[]{ 
+        Spc::LoadMode::Stream, 
+        Spc::LoadMode::Mapped, 
+        Spc::LoadMode::Metadata,
+        Spc::LoadMode::Buffered 
+    };
+
+    for (Spc::LoadMode mode : modes)
+    {
+        CreateTestFile(filePath);
+        Spc::File file(filePath.string());
+        file.Load();
+
+        EXPECT_TRUE(file.Tag().HasExtendedData());
+        EXPECT_EQ(file.Tag().OstTitle().Value(), expectedOstTitle);
+
+        fs::resize_file(filePath, Spc::Id666::Extended::dataOffset);
+        file.Load(mode);
+
+        EXPECT_FALSE(file.Tag().HasExtendedData());
+        EXPECT_EQ(file.Tag().UndecodedItemCount(), 0);
+        EXPECT_EQ(file.Tag().OstTitle().Value(), "");
+    }
+
+    fs::remove_all(tempDir);
+}
+
+TEST_F(FileTests, ThrowsWhenMetadataFileIsTruncated)
+{
+    Spc::File file("test.spc", mockFileStream);
+
+    EXPECT_CALL(*mockFileStream, Open(Binary::FileMode::Read));
+    EXPECT_CALL(*mockFileStream, IsOpen())
+        .WillOnce(testing::Return(true))
+        .WillOnce(testing::Return(true));
+    EXPECT_CALL(*mockFileStream, FileSize()).WillOnce(testing::Return(0x100));
+    EXPECT_CALL(*mockFileStream, Close());
+
+    EXPECT_THROW(file.Load(Spc::LoadMode::Metadata), 
+                 Spc::FileCorruptException);
+}
+
+TEST_F(FileTests, LoadsBufferedFileWithOneRead)
+{
+    Spc::File file("test.spc", mockFileStream);
+    const size_t fileSize = Spc::Id666::Extended::dataOffset;
+
+    {
+        testing::InSequence sequence;
+
+        EXPECT_CALL(*mockFileStream, Open(Binary::FileMode::Read));
+        EXPECT_CALL(*mockFileStream, IsOpen()).WillOnce(testing::Return(true));
+        EXPECT_CALL(*mockFileStream, FileSize())
+            .WillOnce(testing::Return(fileSize));
+        EXPECT_CALL(*mockFileStream, Read(testing::A<Binary::DataField&>()))
+            .WillOnce(testing::Invoke([fileSize](Binary::DataField& field)
+            {
+                EXPECT_EQ(field.Size(), fileSize);
+                std::memcpy(field.RawData(), 
+                            Spc::headerId, 
+                            std::strlen(Spc::headerId));
+            }));
+        EXPECT_CALL(*mockFileStream, Close());
+    }
+
+    file.Load(Spc::LoadMode::Buffered);
+
+    EXPECT_TRUE(file.HasSections());
+    EXPECT_FALSE(file.IsMapped());
+    EXPECT_EQ(file.Header().id.Value(), Spc::headerId);
+}
+
+TEST_F(FileTests, LoadsBufferedFileProperly)
+{
+    namespace fs = std::filesystem;
+
+    const fs::path tempDir = CreateTempDirectory();
+    const fs::path filePath = tempDir / "buffered.spc";
+    CreateTestFile(filePath);
+
+    Spc::File file(filePath.string());
+    file.Load(Spc::LoadMode::Buffered);
+
+    EXPECT_TRUE(file.HasSections());
+    EXPECT_EQ(file.Header().id.Value(), Spc::headerId);
+    EXPECT_EQ(file.Tag().SongTitle().Value(), expectedSongTitle);
+    EXPECT_EQ(file.Tag().OstTitle().Value(), expectedOstTitle);
+    EXPECT_EQ(file.Tag().IntroLength().Value(), expectedIntroLength);
+    EXPECT_EQ(file.Tag().PreampLevel().Value(), expectedPreampLevel);
+    TestViewMatches(file.RamView(), expectedRam);
+    TestViewMatches(file.DspRegistersView(), expectedDspRegisters);
+    TestViewMatches(file.UnusedView(), expectedUnused);
+    TestViewMatches(file.ExtraRamView(), expectedExtraRam);
+    TestViewMatches(file.TagView(), *expectedTag.FieldData());
+    EXPECT_FALSE(file.IsModified());
+
+    fs::remove_all(tempDir);
+}
+
+TEST_F(FileTests, ThrowsWhenBufferedExtendedDataIsCorrupt)
+{
+    namespace fs = std::filesystem;
+
+    const fs::path tempDir = CreateTempDirectory();
+    const fs::path filePath = tempDir / "corrupt.spc";
+    CreateTestFile(filePath);
+
+    // Claim the extended chunk is larger than the data that follows it.
+    {
+        std::fstream stream(filePath, 
+                            std::ios::binary | std::ios::in | std::ios::out);
+        stream.seekp(Spc::Id666::Extended::dataOffset + 4);
+        const char size[]{ '\xFF', '\xFF', '\x00', '\x00' };
+        stream.write(size, sizeof(size));
+    }
+
+    Spc::File file(filePath.string());
+
+    EXPECT_THROW(file.Load(Spc::LoadMode::Buffered), 
+                 Spc::FileCorruptException);
+
+    fs::remove_all(tempDir);
+}
+
+TEST_F(FileTests, SavesToMemoryLikeDisk)
+{
+    namespace fs = std::filesystem;
+
+    const fs::path tempDir = CreateTempDirectory();
+    const fs::path filePath = tempDir / "memory.spc";
+    CreateTestFile(filePath);
+
+    std::ifstream stream(filePath, std::ios::binary);
+    const std::vector<char> expectedBytes{ 
+        std::istreambuf_iterator<char>(stream), 
+        std::istreambuf_iterator<char>() 
+    };
+
+    Spc::File file("unused.spc", mockFileStream);
+    EXPECT_CALL(*mockFileStream, Open(testing::_)).Times(0);
+    file.SetHeader(expectedHeader);
+    file.SetTag(expectedTag);
+    file.SetRam(expectedRam);
+    file.SetDspRegisters(expectedDspRegisters);
+    file.SetUnused(expectedUnused);
+    file.SetExtraRam(expectedExtraRam);
+
+    std::vector<char> bytes;
+    file.Save(bytes);
+
+    EXPECT_EQ(bytes.size(), file.SerializedSize());
+    EXPECT_EQ(bytes, expectedBytes);
+
+    fs::remove_all(tempDir);
+}
+
+TEST_F(FileTests, LoadsFromMemoryProperly)
+{
+    Spc::File source("unused.spc", mockFileStream);
+    source.SetHeader(expectedHeader);
+    source.SetTag(expectedTag);
+    source.SetRam(expectedRam);
+    source.SetDspRegisters(expectedDspRegisters);
+    source.SetUnused(expectedUnused);
+    source.SetExtraRam(expectedExtraRam);
+
+    std::vector<char> bytes;
+    source.Save(bytes);
+
+    Spc::File file{ Spc::ByteView{ bytes.data(), bytes.size() } };
+
+    // The bytes are copied, so the file must not depend on the buffer.
+    std::fill(bytes.begin(), bytes.end(), '\0');
+
+    EXPECT_TRUE(file.Path().empty());
+    EXPECT_TRUE(file.HasSections());
+    EXPECT_EQ(file.Header().id.Value(), Spc::headerId);
+    EXPECT_EQ(file.Tag().SongTitle().Value(), expectedSongTitle);
+    EXPECT_EQ(file.Tag().OstTitle().Value(), expectedOstTitle);
+    EXPECT_EQ(file.Tag().PreampLevel().Value(), expectedPreampLevel);
+    TestViewMatches(file.RamView(), expectedRam);
+    TestViewMatches(file.DspRegistersView(), expectedDspRegisters);
+    TestViewMatches(file.UnusedView(), expectedUnused);
+    TestViewMatches(file.ExtraRamView(), expectedExtraRam);
+    TestViewMatches(file.TagView(), *expectedTag.FieldData());
+}
+
+TEST_F(FileTests, ThrowsWhenMemoryIsTooSmall)
+{
+    Spc::File file("unused.spc", mockFileStream);
+    file.SetTag(expectedTag);
+
+    std::vector<char> buffer(file.SerializedSize() - 1);
+
+    EXPECT_THROW(file.Save(buffer.data(), buffer.size()), std::out_of_range);
+    EXPECT_THROW(Spc::File(Spc::ByteView{ buffer.data(), 0x100 }), 
+                 Spc::FileCorruptException);
+}
+
+TEST_F(FileTests, ProbesFileOnDisk)
+{
+    namespace fs = std::filesystem;
+
+    const fs::path tempDir = CreateTempDirectory();
+    const fs::path filePath = tempDir / "probe.spc";
+    CreateTestFile(filePath);
+
+    Spc::ProbeResult result = Spc::File::Probe(filePath.string());
+
+    EXPECT_TRUE(result.isSpc);
+    EXPECT_TRUE(result.containsTag);
+    ASSERT_TRUE(result.tagType.has_value());
+    EXPECT_EQ(*result.tagType, expectedTag.DetermineType());
+
+    EXPECT_THROW(Spc::File::Probe((tempDir / "missing.spc").string()),
+                 Spc::FileOperationException);
+
+    fs::remove_all(tempDir);
+}
+
+TEST_F(FileTests, ProbesBytesProperly)
+{
+    std::vector<char> bytes(Spc::ramInfo.offset);
+    std::memcpy(bytes.data(), Spc::headerId, std::strlen(Spc::headerId));
+    bytes[Spc::headerSeparatorInfo.offset] = Spc::separatorChar;
+    bytes[Spc::headerSeparatorInfo.offset + 1] = Spc::separatorChar;
+    bytes[Spc::headerContainsTagInfo.offset] = Spc::headerContainsNoTag;
+
+    Spc::ProbeResult result = Spc::File::Probe(
+        Spc::ByteView{ bytes.data(), bytes.size() });
+
+    EXPECT_TRUE(result.isSpc);
+    EXPECT_FALSE(result.containsTag);
+    EXPECT_FALSE(result.tagType.has_value());
+
+    bytes[Spc::headerContainsTagInfo.offset] = Spc::headerContainsTag;
+    result = Spc::File::Probe(Spc::ByteView{ bytes.data(), bytes.size() });
+
+    EXPECT_TRUE(result.containsTag);
+    EXPECT_EQ(result.tagType, Spc::Id666::TagType::Text);
+
+    // Too short to hold the tag, but long enough to identify the file.
+    result = Spc::File::Probe(Spc::ByteView{ bytes.data(), 0x30 });
+
+    EXPECT_TRUE(result.isSpc);
+    EXPECT_FALSE(result.tagType.has_value());
+
+    bytes[Spc::headerSeparatorInfo.offset + 1] = 0;
+    result = Spc::File::Probe(Spc::ByteView{ bytes.data(), bytes.size() });
+
+    EXPECT_FALSE(result.isSpc);
+    EXPECT_FALSE(Spc::File::Probe(Spc::ByteView{ "SNES", 4 }).isSpc);
+}
+
+TEST_F(FileTests, SavesTagWithoutRewritingSections)
+{
+    Spc::File file("test.spc", mockFileStream);
+    file.SetTag(expectedTag);
+
+    {
+        testing::InSequence sequence;
+
+        EXPECT_CALL(*mockFileStream, Open(Binary::FileMode::ReadWrite));
+        EXPECT_CALL(*mockFileStream, IsOpen()).WillOnce(testing::Return(true));
+        EXPECT_CALL(*mockFileStream, FileSize())
+            .WillOnce(testing::Return(Spc::Id666::Extended::dataOffset));
+        EXPECT_CALL(*mockFileStream, SetPosition(Spc::Id666::tagOffset));
+        EXPECT_CALL(*mockFileStream, 
+                    Write(testing::A<const Binary::DataField&>()))
+            .WillOnce(testing::Invoke([](const Binary::DataField& field)
+            {
+                EXPECT_EQ(field.Size(), Spc::Id666::tagSize);
+            }));
+        EXPECT_CALL(*mockFileStream, 
+                    SetPosition(Spc::Id666::Extended::dataOffset));
+        EXPECT_CALL(*mockFileStream, 
+                    Write(testing::A<const Binary::DataField&>()))
+            .Times(1);
+        EXPECT_CALL(*mockFileStream, Close());
+    }
+
+    file.SaveTag();
+}
+
+TEST_F(FileTests, SavesTagAndResizesExtendedData)
+{
+    namespace fs = std::filesystem;
+
+    const fs::path tempDir = CreateTempDirectory();
+    const fs::path filePath = tempDir / "patch.spc";
+    CreateTestFile(filePath);
+
+    const std::string longComments(200, 'C');
+    const uintmax_t originalSize = fs::file_size(filePath);
+
+    Spc::File file(filePath.string());
+    file.Load(Spc::LoadMode::Metadata);
+    Spc::Id666::Tag tag = file.Tag();
+    tag.SetComments(longComments);
+    file.SaveTag();
+
+    const uintmax_t extendedSize = fs::file_size(filePath);
+    EXPECT_GT(extendedSize, originalSize);
+
+    tag.SetComments(expectedComments);
+    file.SaveTag();
+
+    EXPECT_EQ(fs::file_size(filePath), originalSize);
+
+    Spc::File reloaded(filePath.string());
+    reloaded.Load();
+
+    EXPECT_EQ(reloaded.Tag().Comments().Value(), expectedComments);
+    EXPECT_EQ(reloaded.Tag().OstTitle().Value(), expectedOstTitle);
+    EXPECT_EQ(reloaded.Header().pcRegister.RawData()[0], 0x34);
+    TestViewMatches(reloaded.RamView(), expectedRam);
+    TestViewMatches(reloaded.ExtraRamView(), expectedExtraRam);
+
+    fs::remove_all(tempDir);
+}
+
+TEST_F(FileTests, SavesNewFileInFull)
+{
+    Spc::File file("test.spc", mockFileStream);
+    file.SetHeader(expectedHeader);
+    file.SetTag(expectedTag);
+    file.SetRam(expectedRam);
+    file.SetDspRegisters(expectedDspRegisters);
+    file.SetUnused(expectedUnused);
+    file.SetExtraRam(expectedExtraRam);
+
+    MockFileWrites();
+
+    file.Save();
+
+    EXPECT_FALSE(file.IsModified());
+}
+
+TEST_F(FileTests, DoesNotWriteUnmodifiedFile)
+{
+    Spc::File file("test.spc", mockFileStream);
+    MockFileReads(false);
+    file.Load();
+
+    EXPECT_FALSE(file.IsModified());
+    EXPECT_CALL(*mockFileStream, Open(testing::_)).Times(0);
+
+    file.SetRam(expectedRam);
+    file.Save();
+}
+
+TEST_F(FileTests, SavesOnlyChangedRamPages)
+{
+    Spc::File file("test.spc", mockFileStream);
+    MockFileReads(false);
+    file.Load();
+
+    const char patch[]{ 0x7F, 0x7F };
+    const size_t patchOffset{ 0x12FF };
+    file.PatchRam(patchOffset, Spc::ByteView{ patch, sizeof(patch) });
+
+    EXPECT_TRUE(file.IsModified());
+
+    {
+        testing::InSequence sequence;
+
+        EXPECT_CALL(*mockFileStream, Open(Binary::FileMode::ReadWrite));
+        EXPECT_CALL(*mockFileStream, IsOpen()).WillOnce(testing::Return(true));
+        EXPECT_CALL(*mockFileStream, FileSize())
+            .WillOnce(testing::Return(Spc::Id666::Extended::dataOffset));
+        EXPECT_CALL(*mockFileStream, SetPosition(Spc::ramInfo.offset + 0x1200));
+        EXPECT_CALL(*mockFileStream, 
+                    Write(testing::A<const Binary::DataField&>()))
+            .WillOnce(testing::Invoke([](const Binary::DataField& field)
+            {
+                ASSERT_EQ(field.Size(), 2 * Spc::ramPageSize);
+                EXPECT_EQ(field.RawData()[0xFF], 0x7F);
+                EXPECT_EQ(field.RawData()[0x100], 0x7F);
+                EXPECT_EQ(field.RawData()[0x101], 0x01);
+            }));
+        EXPECT_CALL(*mockFileStream, Close());
+    }
+
+    file.Save();
+
+    EXPECT_FALSE(file.IsModified());
+}
+
+TEST_F(FileTests, SavesPatchedRamToDisk)
+{
+    namespace fs = std::filesystem;
+
+    const fs::path tempDir = CreateTempDirectory();
+    const fs::path filePath = tempDir / "patch.spc";
+    CreateTestFile(filePath);
+
+    const char echo[]{ 0x00, 0x20 };
+
+    {
+        Spc::File file(filePath.string());
+        file.Load();
+        file.PatchRam(0xF000, Spc::ByteView{ echo, sizeof(echo) });
+        file.PatchDspRegisters(0x6C, Spc::ByteView{ echo, 1 });
+        file.Save();
+    }
+
+    expectedRam.RawData()[0xF000] = echo[0];
+    expectedRam.RawData()[0xF001] = echo[1];
+    expectedDspRegisters.RawData()[0x6C] = echo[0];
+
+    Spc::File file(filePath.string());
+    file.Load();
+
+    TestViewMatches(file.RamView(), expectedRam);
+    TestViewMatches(file.DspRegistersView(), expectedDspRegisters);
+    TestViewMatches(file.ExtraRamView(), expectedExtraRam);
+    EXPECT_EQ(file.Tag().SongTitle().Value(), expectedSongTitle);
+
+    fs::remove_all(tempDir);
+}
+
+TEST_F(FileTests, SavesShortFileInFull)
+{
+    namespace fs = std::filesystem;
+
+    const fs::path tempDir = CreateTempDirectory();
+    const fs::path filePath = tempDir / "short.spc";
+    CreateTestFile(filePath);
+
+    Spc::File file(filePath.string());
+    file.Load();
+    fs::resize_file(filePath, Spc::Id666::tagOffset);
+
+    Spc::Id666::Tag tag = file.Tag();
+    tag.SetGameTitle("Rewritten");
+    file.SetTag(tag);
+
+    ASSERT_NO_THROW(file.Save());
+    EXPECT_EQ(fs::file_size(filePath), file.SerializedSize());
+
+    Spc::File saved(filePath.string());
+    saved.Load();
+
+    TestViewMatches(saved.RamView(), expectedRam);
+    TestViewMatches(saved.ExtraRamView(), expectedExtraRam);
+    EXPECT_EQ(saved.Tag().GameTitle().Value(), "Rewritten");
+
+    fs::remove_all(tempDir);
+}
+
+TEST_F(FileTests, ClearsStaleExtendedDataThroughInjectedStream)
+{
+    namespace fs = std::filesystem;
+
+    const fs::path tempDir = CreateTempDirectory();
+    const fs::path filePath = tempDir / "injected.spc";
+    CreateTestFile(filePath);
+    const uintmax_t originalSize = fs::file_size(filePath);
+
+    {
+        Spc::File file(filePath.string(), 
+            std::make_shared<Binary::StandardFileStream>(filePath.string()));
+        file.Load();
+
+        Spc::Id666::Tag tag = file.Tag();
+        tag.SetExtendedItems(Spc::Id666::Extended::ItemTable{});
+        file.SetTag(tag);
+        file.Save();
+    }
+
+    // The injected stream cannot be truncated, so the file keeps its size.
+    EXPECT_EQ(fs::file_size(filePath), originalSize);
+
+    Spc::File saved(filePath.string());
+    saved.Load();
+
+    EXPECT_FALSE(saved.Tag().HasExtendedData());
+    EXPECT_EQ(saved.Tag().SongTitle().Value(), expectedSongTitle);
+
+    fs::remove_all(tempDir);
+}
+
+TEST_F(FileTests, DoesNotPatchRamThatWasNotLoaded)
+{
+    namespace fs = std::filesystem;
+
+    const fs::path tempDir = CreateTempDirectory();
+    const fs::path filePath = tempDir / "metadata.spc";
+    CreateTestFile(filePath);
+
+    Spc::File file(filePath.string());
+    file.Load(Spc::LoadMode::Metadata);
+
+    const char patch[]{ 0x00 };
+
+    EXPECT_THROW(file.PatchRam(0, Spc::ByteView{ patch, sizeof(patch) }),
+                 Spc::FileOperationException);
+    EXPECT_THROW(file.PatchRam(Spc::ramInfo.size, 
+                               Spc::ByteView{ patch, sizeof(patch) }),
+                 Spc::FileOperationException);
+
+    fs::remove_all(tempDir);
+}
@@ -20,6 +20,8 @@
 #include <gtest/gtest.h>
 #include <LibCppSpc.h>
 #include <memory>
+#include <filesystem>
+#include <vector>
 #include "MockFileStream.h"
 
 inline constexpr size_t alignment{ 4 };
@@ -74,6 +76,11 @@ protected:
 
     void MockBufferStreamWrite(Binary::BufferStream* stream);
 
+    void MockItemRead(uint8_t id, 
+                      uint8_t type, 
+                      uint16_t data, 
+                      std::string payload);
+
     void MockStringRead(uint8_t id, std::string expectedValue);
 
     void MockStringWrite(uint8_t id, std::string value);
@@ -102,6 +109,10 @@ protected:
 
     void MockFileWrites();
 
+    void MockExtendedDataWrites();
+
+    void MockTagPatchWrites();
+
     size_t CalculateSizeWithPadding(std::string value) const;
 
     size_t CalculateExpectedChunkSize(bool useLongTagValues) const;
@@ -110,7 +121,17 @@ protected:
 
     void TestFileLoadsAndSavesProperly(bool useLongTagValues);
 
+    std::filesystem::path CreateTempDirectory() const;
+
+    void CreateTestFile(const std::filesystem::path& filePath);
+
+    void TestViewMatches(Spc::ByteView view, 
+                         const Binary::BufferStream& expected);
+
     std::shared_ptr<MockFileStream> mockFileStream;
+
+    // The bytes of the extended items returned by the mocked chunk read.
+    std::vector<char> mockedChunk;
 };
 
 bool AllBytesMatch(const Binary::DataField* expected,
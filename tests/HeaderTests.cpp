@@ -48,3 +48,22 @@ TEST_F(HeaderTests, SpcFieldsReturnsAllHeaderFieldsInCorrectOrder)
     EXPECT_EQ(fields[9], &header->spRegister);
     EXPECT_EQ(fields[10], &header->reserved);
 }
+
+TEST_F(HeaderTests, CopiesPointToTheirOwnFields)
+{
+    header->containsTag.SetValue(std::to_string(Spc::headerContainsTag));
+
+    Spc::Header copy{ *header };
+    Spc::Header assigned;
+    assigned = *header;
+
+    EXPECT_TRUE(copy.ContainsTag());
+    EXPECT_TRUE(assigned.ContainsTag());
+    EXPECT_EQ(copy.SpcFields()[0], &copy.id);
+    EXPECT_EQ(copy.SpcFields()[10], &copy.reserved);
+    EXPECT_EQ(assigned.SpcFields()[2], &assigned.containsTag);
+
+    header.reset();
+
+    EXPECT_TRUE(copy.ContainsTag());
+}
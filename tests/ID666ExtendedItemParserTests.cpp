@@ -0,0 +1,169 @@
+// ID666ExtendedItemParserTests.cpp - Defines the ID666ExtendedItemParserTests tests.
+//
+// Copyright (C) 2026 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "ID666ExtendedItemParserTests.h"
+
+void ID666ExtendedItemParserTests::SetUp()
+{
+    chunk.clear();
+}
+
+void ID666ExtendedItemParserTests::AppendItem(uint8_t id, 
+                                              uint8_t type, 
+                                              uint16_t data, 
+                                              const std::string& payload)
+{
+    chunk.push_back(static_cast<char>(id));
+    chunk.push_back(static_cast<char>(type));
+    chunk.push_back(static_cast<char>(data & 0xFF));
+    chunk.push_back(static_cast<char>(data >> 8));
+    chunk.insert(chunk.end(), payload.begin(), payload.end());
+}
+
+Spc::ByteView ID666ExtendedItemParserTests::ChunkView() const
+{
+    return Spc::ByteView{ chunk.data(), chunk.size() };
+}
+
+TEST_F(ID666ExtendedItemParserTests, ReturnsViewsOfTheChunkBytes)
+{
+    AppendItem(Spc::Id666::Extended::ostTitleInfo.id, 
+               Spc::Id666::Extended::stringType, 
+               5, 
+               std::string{ "Title\0\0\0", 8 });
+    AppendItem(Spc::Id666::Extended::ostDiscInfo.id, 
+               Spc::Id666::Extended::lengthType, 
+               2, 
+               "");
+    AppendItem(Spc::Id666::Extended::introLengthInfo.id, 
+               Spc::Id666::Extended::integerType, 
+               4, 
+               std::string{ "\x00\x7D\x00\x00", 4 });
+
+    Spc::Id666::Extended::ItemParser parser{ ChunkView(), chunk.size() };
+
+    auto title = parser.Next();
+    ASSERT_TRUE(title.has_value());
+    EXPECT_EQ(title->payload.Data(), chunk.data() + 4);
+    EXPECT_EQ(title->payload.Size(), 5);
+    EXPECT_EQ(title->padding.Size(), 3);
+
+    auto disc = parser.Next();
+    ASSERT_TRUE(disc.has_value());
+    EXPECT_EQ(disc->data, 2);
+    EXPECT_TRUE(disc->payload.Empty());
+
+    auto intro = parser.Next();
+    ASSERT_TRUE(intro.has_value());
+    EXPECT_EQ(intro->payload.Data(), chunk.data() + 20);
+    EXPECT_EQ(intro->payload.Size(), 4);
+
+    EXPECT_FALSE(parser.Next().has_value());
+}
+
+TEST_F(ID666ExtendedItemParserTests, ThrowsWhenItemIsInvalid)
+{
+    AppendItem(Spc::Id666::Extended::ostTitleInfo.id, 9, 0, "");
+    Spc::Id666::Extended::ItemParser badType{ ChunkView(), chunk.size() };
+    EXPECT_THROW(badType.Next(), Spc::FileCorruptException);
+
+    chunk.clear();
+    AppendItem(0x8, Spc::Id666::Extended::lengthType, 0, "");
+    Spc::Id666::Extended::ItemParser badId{ ChunkView(), chunk.size() };
+    EXPECT_THROW(badId.Next(), Spc::FileCorruptException);
+
+    chunk.clear();
+    AppendItem(Spc::Id666::Extended::ostTitleInfo.id, 
+               Spc::Id666::Extended::lengthType, 
+               0, 
+               "");
+    Spc::Id666::Extended::ItemParser wrongType{ ChunkView(), chunk.size() };
+    EXPECT_THROW(wrongType.Next(), Spc::FileCorruptException);
+}
+
+TEST_F(ID666ExtendedItemParserTests, ThrowsWhenItemExceedsChunk)
+{
+    AppendItem(Spc::Id666::Extended::ostTitleInfo.id, 
+               Spc::Id666::Extended::stringType, 
+               8, 
+               "Title");
+
+    Spc::Id666::Extended::ItemParser pastChunk{ ChunkView(), chunk.size() };
+    EXPECT_THROW(pastChunk.Next(), Spc::FileCorruptException);
+
+    Spc::Id666::Extended::ItemParser pastBytes{ ChunkView(), 12 };
+    EXPECT_THROW(pastBytes.Next(), Spc::FileCorruptException);
+}
+
+TEST_F(ID666ExtendedItemParserTests, TagDecodesOnlyItemsThatAreRead)
+{
+    AppendItem(Spc::Id666::Extended::ostTitleInfo.id, 
+               Spc::Id666::Extended::stringType, 
+               4, 
+               "OST!");
+    AppendItem(Spc::Id666::Extended::publisherNameInfo.id, 
+               Spc::Id666::Extended::stringType, 
+               4, 
+               "Pub!");
+
+    Spc::Id666::Extended::ItemParser parser{ ChunkView(), chunk.size() };
+    Spc::Id666::Tag tag;
+    tag.SetExtendedItems(parser.ParseAll());
+
+    EXPECT_EQ(tag.OstTitle().Value(), "OST!");
+    EXPECT_EQ(tag.ExtendedItems().Count(), 2);
+    EXPECT_EQ(tag.ExtendedItems().Size(), chunk.size());
+
+    tag.SetPublisherName("Publisher");
+
+    EXPECT_EQ(tag.ExtendedData()->ostTitle->extendedData->Size(), 4);
+    EXPECT_EQ(tag.PublisherName().Value(), "Publisher");
+    EXPECT_EQ(tag.ExtendedItems().Count(), 2);
+}
+
+TEST_F(ID666ExtendedItemParserTests, TagDecodeLeavesItemsUndecoded)
+{
+    AppendItem(Spc::Id666::Extended::ostTitleInfo.id, 
+               Spc::Id666::Extended::stringType, 
+               4, 
+               "OST!");
+    AppendItem(Spc::Id666::Extended::ostTrackInfo.id, 
+               Spc::Id666::Extended::lengthType, 
+               static_cast<uint16_t>(12 << 8 | 'b'), 
+               "");
+    AppendItem(Spc::Id666::Extended::copyrightYearInfo.id, 
+               Spc::Id666::Extended::lengthType, 
+               1994, 
+               "");
+    AppendItem(Spc::Id666::Extended::introLengthInfo.id, 
+               Spc::Id666::Extended::integerType, 
+               4, 
+               std::string{ "\x00\x7D\x00\x00", 4 });
+
+    Spc::Id666::Extended::ItemParser parser{ ChunkView(), chunk.size() };
+    Spc::Id666::Tag tag;
+    tag.SetExtendedItems(parser.ParseAll());
+
+    const Spc::Id666::TagRecord record = tag.Decode();
+
+    EXPECT_EQ(record.ostTitle, "OST!");
+    EXPECT_EQ(record.ostTrack, 12);
+    EXPECT_EQ(record.ostTrackSuffix, 'b');
+    EXPECT_EQ(record.copyrightYear, 1994);
+    EXPECT_EQ(record.introLength, 0x7D00u);
+    EXPECT_EQ(tag.IntroLengthValue(), 0x7D00u);
+    EXPECT_EQ(tag.UndecodedItemCount(), 4);
+}
@@ -0,0 +1,40 @@
+// ID666ExtendedItemParserTests.h - Declares the ID666ExtendedItemParserTests class.
+//
+// Copyright (C) 2026 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef ID666_EXTENDED_ITEM_PARSER_TESTS_H
+#define ID666_EXTENDED_ITEM_PARSER_TESTS_H
+
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+#include "LibCppSpc.h"
+
+class ID666ExtendedItemParserTests : public ::testing::Test
+{
+protected:
+    std::vector<char> chunk;
+
+    void SetUp() override;
+
+    void AppendItem(uint8_t id, 
+                    uint8_t type, 
+                    uint16_t data, 
+                    const std::string& payload);
+
+    Spc::ByteView ChunkView() const;
+};
+
+#endif
@@ -0,0 +1,162 @@
+// ID666ExtendedItemTableTests.cpp - Defines the ID666ExtendedItemTableTests tests.
+//
+// Copyright (C) 2026 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "ID666ExtendedItemTableTests.h"
+
+#include <vector>
+
+void ID666ExtendedItemTableTests::SetUp()
+{
+    // No setup needed for these tests.
+}
+
+Spc::Id666::Extended::ItemView ID666ExtendedItemTableTests::StringItem(
+    uint8_t id, 
+    std::string_view value)
+{
+    Spc::Id666::Extended::ItemView item;
+    item.id = id;
+    item.type = Spc::Id666::Extended::stringType;
+    item.data = static_cast<uint16_t>(value.size());
+    item.payload = Spc::ByteView{ value.data(), value.size() };
+    return item;
+}
+
+TEST_F(ID666ExtendedItemTableTests, VisitsItemsInAscendingIdOrder)
+{
+    Spc::Id666::Extended::ItemTable items;
+    items.Set(StringItem(Spc::Id666::Extended::publisherNameInfo.id, "Pub"));
+    items.Set(StringItem(Spc::Id666::Extended::songTitleInfo.id, "Song"));
+    items.Set(StringItem(Spc::Id666::Extended::ostTitleInfo.id, "OST"));
+
+    std::vector<uint8_t> ids;
+
+    for (Spc::Id666::Extended::ItemView item : items)
+    {
+        ids.push_back(item.id);
+    }
+
+    std::vector<uint8_t> expected{ Spc::Id666::Extended::songTitleInfo.id,
+                                   Spc::Id666::Extended::ostTitleInfo.id,
+                                   Spc::Id666::Extended::publisherNameInfo.id };
+    EXPECT_EQ(ids, expected);
+    EXPECT_EQ(items.Count(), 3);
+}
+
+TEST_F(ID666ExtendedItemTableTests, PadsStringItemsToFourBytes)
+{
+    Spc::Id666::Extended::ItemTable items;
+    items.Set(StringItem(Spc::Id666::Extended::songTitleInfo.id, "Hello"));
+
+    auto item = items.Find(Spc::Id666::Extended::songTitleInfo.id);
+
+    ASSERT_TRUE(item.has_value());
+    EXPECT_EQ(item->data, 5);
+    EXPECT_EQ(item->payload.Size(), 5);
+    EXPECT_EQ(item->padding.Size(), 3);
+    EXPECT_EQ(item->Size(), 12);
+    EXPECT_EQ(items.Size(), 12);
+}
+
+TEST_F(ID666ExtendedItemTableTests, ReplacesItemsWithTheSameId)
+{
+    Spc::Id666::Extended::ItemTable items;
+    items.Set(StringItem(Spc::Id666::Extended::songTitleInfo.id, "Song"));
+    items.Set(StringItem(Spc::Id666::Extended::gameTitleInfo.id, "Game"));
+    items.Set(StringItem(Spc::Id666::Extended::songTitleInfo.id, "Longer"));
+
+    auto item = items.Find(Spc::Id666::Extended::songTitleInfo.id);
+
+    ASSERT_TRUE(item.has_value());
+    EXPECT_EQ(std::string_view(item->payload.Data(), item->payload.Size()), 
+              "Longer");
+    EXPECT_EQ(items.Count(), 2);
+    EXPECT_EQ(items.Size(), 12 + 8);
+}
+
+TEST_F(ID666ExtendedItemTableTests, RemovesItems)
+{
+    Spc::Id666::Extended::ItemTable items;
+    items.Set(StringItem(Spc::Id666::Extended::songTitleInfo.id, "Song"));
+    items.Set(StringItem(Spc::Id666::Extended::gameTitleInfo.id, "Game"));
+    items.Remove(Spc::Id666::Extended::songTitleInfo.id);
+
+    EXPECT_FALSE(items.Contains(Spc::Id666::Extended::songTitleInfo.id));
+    ASSERT_TRUE(items.Contains(Spc::Id666::Extended::gameTitleInfo.id));
+    EXPECT_EQ(items.Find(Spc::Id666::Extended::gameTitleInfo.id)->payload[0], 
+              'G');
+    EXPECT_EQ(items.Count(), 1);
+
+    items.Clear();
+
+    EXPECT_TRUE(items.Empty());
+    EXPECT_EQ(items.Size(), 0);
+}
+
+TEST_F(ID666ExtendedItemTableTests, RoundTripsThroughExtendedData)
+{
+    Spc::Id666::Tag tag;
+    tag.SetOstTitle("Soundtrack");
+    tag.SetCopyrightYear(static_cast<uint16_t>(1994));
+    tag.SetIntroLength(static_cast<uint32_t>(64000));
+
+    auto items = Spc::Id666::Extended::ItemTable::FromData(*tag.ExtendedData());
+
+    EXPECT_EQ(items.Count(), 3);
+    EXPECT_EQ(items.Size(), tag.ExtendedData()->Size());
+
+    Spc::Id666::Tag copy;
+    copy.SetExtendedItems(items);
+
+    EXPECT_TRUE(copy.HasExtendedData());
+    EXPECT_EQ(copy.OstTitle().Value(), "Soundtrack");
+    EXPECT_EQ(copy.CopyrightYear().ToUInt32(), 1994);
+    EXPECT_EQ(copy.IntroLength().ToUInt32(), 64000);
+    EXPECT_EQ(copy.ExtendedData()->Size(), items.Size());
+}
+
+TEST_F(ID666ExtendedItemTableTests, WritesChunkInAscendingIdOrder)
+{
+    Spc::Id666::Extended::ItemTable items;
+    items.Set(StringItem(Spc::Id666::Extended::gameTitleInfo.id, "Game"));
+    items.Set(StringItem(Spc::Id666::Extended::songTitleInfo.id, "Song!"));
+
+    std::vector<char> chunk(items.ChunkSize());
+    items.WriteChunk(chunk.data());
+
+    ASSERT_EQ(chunk.size(), Spc::Id666::Extended::chunkHeaderSize + 20);
+    EXPECT_EQ(std::string_view(chunk.data(), 4), "xid6");
+
+    Spc::ByteCursor cursor{ Spc::ByteView{ chunk.data(), chunk.size() } };
+    cursor.Skip(4);
+    EXPECT_EQ(cursor.ReadUInt32(), 20);
+
+    Spc::Id666::Extended::ItemParser parser{ 
+        cursor.Read(cursor.Remaining()), 20 };
+    Spc::Id666::Extended::ItemTable parsed = parser.ParseAll();
+
+    EXPECT_EQ(chunk[Spc::Id666::Extended::chunkHeaderSize], 
+              static_cast<char>(Spc::Id666::Extended::songTitleInfo.id));
+    EXPECT_EQ(parsed.Count(), 2);
+    EXPECT_EQ(parsed.Find(Spc::Id666::Extended::songTitleInfo.id)->data, 5);
+}
+
+TEST_F(ID666ExtendedItemTableTests, WritesNothingWhenEmpty)
+{
+    Spc::Id666::Extended::ItemTable items;
+
+    EXPECT_EQ(items.ChunkSize(), 0);
+}
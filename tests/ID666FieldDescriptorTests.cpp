@@ -0,0 +1,79 @@
+// ID666FieldDescriptorTests.cpp - Defines the ID666FieldDescriptorTests tests.
+//
+// Copyright (C) 2026 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "ID666FieldDescriptorTests.h"
+
+void ID666FieldDescriptorTests::SetUp()
+{
+    // No setup needed for these tests.
+}
+
+TEST_F(ID666FieldDescriptorTests, FindsFieldsByExtendedItemId)
+{
+    for (const Spc::Id666::FieldDescriptor* field : 
+         Spc::Id666::fieldDescriptors)
+    {
+        if (field->IsExtended())
+        {
+            EXPECT_EQ(Spc::Id666::FindExtendedField(field->item->id), field)
+                << field->label;
+        }
+    }
+
+    EXPECT_EQ(Spc::Id666::FindExtendedField(0x8), nullptr);
+    EXPECT_EQ(Spc::Id666::FindExtendedField(0xFF), nullptr);
+}
+
+TEST_F(ID666FieldDescriptorTests, CanBeSearchedAtCompileTime)
+{
+    constexpr const Spc::Id666::FieldDescriptor* field{ 
+        Spc::Id666::FindExtendedField(Spc::Id666::Extended::ostTrackInfo.id)
+    };
+
+    static_assert(field == &Spc::Id666::ostTrackField);
+    static_assert(field->max == Spc::Id666::maxTrackNumber);
+    static_assert(!field->InTag());
+}
+
+TEST_F(ID666FieldDescriptorTests, DescribesTagGetterLabels)
+{
+    Spc::Id666::Tag tag;
+
+    EXPECT_EQ(tag.SongTitle().Label(), Spc::Id666::songTitleField.label);
+    EXPECT_EQ(tag.SongLength().Label(), Spc::Id666::songLengthField.label);
+    EXPECT_EQ(tag.PreampLevel().Label(), 
+              Spc::Id666::preampLevelField.extendedLabel);
+}
+
+TEST_F(ID666FieldDescriptorTests, StarsExtendedLabels)
+{
+    for (const Spc::Id666::FieldDescriptor* field : 
+         Spc::Id666::fieldDescriptors)
+    {
+        EXPECT_EQ(field->extendedLabel, std::string{ field->label } + "*");
+    }
+}
+
+TEST_F(ID666FieldDescriptorTests, LimitsTagSettersToTheirRange)
+{
+    Spc::Id666::Tag tag;
+
+    EXPECT_THROW(tag.SetCopyrightYear("65536"), std::out_of_range);
+    EXPECT_NO_THROW(tag.SetCopyrightYear("65535"));
+    EXPECT_EQ(tag.CopyrightYearValue(), 65535);
+    EXPECT_THROW(tag.SetOstDisc("10"), std::out_of_range);
+    EXPECT_THROW(tag.SetSongLength("960"), std::out_of_range);
+}
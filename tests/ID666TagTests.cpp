@@ -2257,4 +2257,370 @@ TEST_F(ID666TagTests, HasExtendedTagWorksProperly)
 
     tag->ExtendedData()->gameTitle = std::make_shared<Spc::Id666::Extended::Item>();
     EXPECT_TRUE(tag->HasExtendedData());
-}
\ No newline at end of file
+}
+TEST_F(ID666TagTests, DeterminesTypeFromRawBytes)
+{
+    using Spc::Id666::Tag;
+    using Spc::Id666::TagType;
+    using Spc::Id666::tagSize;
+
+    EXPECT_EQ(Tag::DetermineType(Spc::ByteView{ textData, tagSize }), 
+              TagType::Text);
+    EXPECT_EQ(Tag::DetermineType(Spc::ByteView{ binaryData, tagSize }), 
+              TagType::Binary);
+    EXPECT_EQ(Tag::DetermineType(Spc::ByteView{ mixedData, tagSize }), 
+              TagType::TextMixed);
+    EXPECT_THROW(Tag::DetermineType(Spc::ByteView{ textData, tagSize - 1 }),
+                 std::out_of_range);
+}
+
+TEST_F(ID666TagTests, RedetectsTypeWhenFieldDataChanges)
+{
+    using Spc::Id666::TagType;
+    using Spc::Id666::tagSize;
+
+    std::memcpy(tag->FieldData()->RawData(), textData, tagSize);
+    EXPECT_EQ(tag->DetermineType(), TagType::Text);
+    EXPECT_EQ(tag->DetermineType(), TagType::Text);
+
+    std::memcpy(tag->FieldData()->RawData(), binaryData, tagSize);
+    EXPECT_EQ(tag->DetermineType(), TagType::Binary);
+
+    // Copies share field data, so they must also share the detected type.
+    Spc::Id666::Tag copy = *tag;
+    EXPECT_EQ(copy.DetermineType(), TagType::Binary);
+
+    std::memcpy(copy.FieldData()->RawData(), mixedData, tagSize);
+    EXPECT_EQ(tag->DetermineType(), TagType::TextMixed);
+}
+
+TEST_F(ID666TagTests, KeepsTypeWhenWritingFields)
+{
+    std::memcpy(tag->FieldData()->RawData(), binaryData, Spc::Id666::tagSize);
+    ASSERT_EQ(tag->DetermineType(), Spc::Id666::TagType::Binary);
+
+    tag->SetSongArtist("New Artist");
+    tag->SetFadeLength("1234");
+    tag->SetSongTitle("New Title");
+
+    EXPECT_EQ(tag->DetermineType(), Spc::Id666::TagType::Binary);
+    EXPECT_EQ(tag->SongArtist().Value(), "New Artist");
+    EXPECT_EQ(tag->FadeLength().ToString(), "1234");
+    EXPECT_EQ(tag->SongTitle().Value(), "New Title");
+}
+
+TEST_F(ID666TagTests, DecodesTextTagProperly)
+{
+    std::memcpy(tag->FieldData()->RawData(), textData, Spc::Id666::tagSize);
+    Spc::Id666::TagRecord record = tag->Decode();
+
+    EXPECT_EQ(record.songTitle, expectedSongTitle);
+    EXPECT_EQ(record.gameTitle, expectedGameTitle);
+    EXPECT_EQ(record.dumperName, expectedDumperName);
+    EXPECT_EQ(record.comments, expectedComments);
+    EXPECT_EQ(record.songArtist, "Artist Name Test ABCDEFGHIJKLMNO");
+    EXPECT_EQ(record.dateDumped, (Spc::Date{ 2000, 2, 6 }));
+    EXPECT_EQ(record.songLength, 123u);
+    EXPECT_EQ(record.fadeLength, 5000u);
+    EXPECT_EQ(record.defaultDisabledChannels, 0x0F);
+    EXPECT_EQ(record.emulatorUsed, 2);
+    EXPECT_TRUE(record.ostTitle.empty());
+    EXPECT_FALSE(record.ostDisc.has_value());
+    EXPECT_FALSE(record.introLength.has_value());
+}
+
+TEST_F(ID666TagTests, DecodesBinaryTagProperly)
+{
+    std::memcpy(tag->FieldData()->RawData(), binaryData, Spc::Id666::tagSize);
+    Spc::Id666::TagRecord record = tag->Decode();
+
+    EXPECT_EQ(record.songTitle, expectedSongTitle);
+    EXPECT_EQ(record.songArtist, "Artist Name Test ABCDEFGHIJKLMNO");
+    EXPECT_EQ(record.dateDumped, (Spc::Date{ 2000, 2, 6 }));
+    EXPECT_EQ(record.songLength, 43u);
+    EXPECT_EQ(record.fadeLength, 5000u);
+    EXPECT_EQ(record.defaultDisabledChannels, 0x0F);
+    EXPECT_EQ(record.emulatorUsed, 2);
+}
+
+TEST_F(ID666TagTests, DecodesMixedTagProperly)
+{
+    std::memcpy(tag->FieldData()->RawData(), mixedData, Spc::Id666::tagSize);
+    Spc::Id666::TagRecord record = tag->Decode();
+
+    EXPECT_EQ(record.songArtist, "Artist Name Test ABCDEFGHIJKLMNO");
+    EXPECT_EQ(record.dateDumped, (Spc::Date{ 2000, 2, 6 }));
+    EXPECT_EQ(record.songLength, 123u);
+    EXPECT_EQ(record.fadeLength, 50000u);
+    EXPECT_EQ(record.emulatorUsed, 2);
+}
+
+TEST_F(ID666TagTests, DecodesExtendedItemsProperly)
+{
+    std::memcpy(tag->FieldData()->RawData(), binaryData, Spc::Id666::tagSize);
+    std::string longTitle(40, 'T');
+    tag->SetSongTitle(longTitle);
+    tag->SetOstTitle("Test OST");
+    tag->SetPublisherName("Test Publisher");
+    tag->SetOstDisc("1");
+    tag->SetOstTrack("5b");
+    tag->SetCopyrightYear("1995");
+    tag->SetIntroLength("64000");
+    tag->SetLoopTimes("3");
+    tag->SetPreampLevel("65536");
+    Spc::Id666::TagRecord record = tag->Decode();
+
+    EXPECT_EQ(record.songTitle, longTitle);
+    EXPECT_EQ(record.ostTitle, "Test OST");
+    EXPECT_EQ(record.publisherName, "Test Publisher");
+    EXPECT_EQ(record.ostDisc, 1);
+    EXPECT_EQ(record.ostTrack, 5);
+    EXPECT_EQ(record.ostTrackSuffix, 'b');
+    EXPECT_EQ(record.copyrightYear, 1995);
+    EXPECT_EQ(record.introLength, 64000u);
+    EXPECT_EQ(record.loopTimes, 3);
+    EXPECT_EQ(record.preampLevel, 65536u);
+    EXPECT_FALSE(record.loopLength.has_value());
+    EXPECT_FALSE(record.mutedVoices.has_value());
+}
+
+TEST_F(ID666TagTests, UpdatesExtendedDataInPlace)
+{
+    tag->SetIntroLength("64000");
+    tag->SetPublisherName("Test Publisher");
+    auto introLength = tag->ExtendedData()->introLength;
+    auto publisherName = tag->ExtendedData()->publisherName;
+    Spc::Field* introData = introLength->extendedData.get();
+    Spc::Field* publisherData = publisherName->extendedData.get();
+
+    // Reading a field returns a copy and leaves the stored item alone.
+    Spc::NumericField field = tag->IntroLength();
+    field.SetValue("1");
+    EXPECT_EQ(introLength->extendedData->Label(), "Temp");
+    EXPECT_EQ(tag->IntroLength().Value(), "64000");
+
+    tag->SetIntroLength("128000");
+    tag->SetPublisherName("Some Publisher");
+    EXPECT_EQ(tag->ExtendedData()->introLength, introLength);
+    EXPECT_EQ(introLength->extendedData.get(), introData);
+    EXPECT_EQ(tag->IntroLength().Value(), "128000");
+    EXPECT_EQ(publisherName->extendedData.get(), publisherData);
+    EXPECT_EQ(tag->PublisherName().Value(), "Some Publisher");
+}
+
+TEST_F(ID666TagTests, SetsTypedBaseFieldsLikeStrings)
+{
+    for (const char* data : { textData, binaryData, mixedData })
+    {
+        Spc::Id666::Tag typed;
+        Spc::Id666::Tag parsed;
+        std::memcpy(typed.FieldData()->RawData(), data, Spc::Id666::tagSize);
+        std::memcpy(parsed.FieldData()->RawData(), data, Spc::Id666::tagSize);
+
+        typed.SetSongLength(200u);
+        typed.SetFadeLength(7500u);
+        typed.SetDateDumped(Spc::Date{ 2001, 3, 4 });
+        parsed.SetSongLength("200");
+        parsed.SetFadeLength("7500");
+        parsed.SetDateDumped("03/04/2001");
+
+        EXPECT_EQ(std::memcmp(typed.FieldData()->RawData(), 
+                              parsed.FieldData()->RawData(), 
+                              Spc::Id666::tagSize), 0);
+        EXPECT_EQ(typed.SongLengthValue(), 200u);
+        EXPECT_EQ(typed.FadeLengthValue(), 7500u);
+        EXPECT_EQ(typed.DateDumpedValue(), (Spc::Date{ 2001, 3, 4 }));
+    }
+}
+
+TEST_F(ID666TagTests, SetsTypedExtendedFieldsLikeStrings)
+{
+    Spc::Id666::Tag parsed;
+    tag->SetOstDisc(uint8_t{ 2 });
+    tag->SetOstTrack(12, 'c');
+    tag->SetCopyrightYear(uint16_t{ 1994 });
+    tag->SetIntroLength(64000u);
+    tag->SetLoopLength(128000u);
+    tag->SetEndLength(32000u);
+    tag->SetFadeLengthExt(16000u);
+    tag->SetLoopTimes(uint8_t{ 3 });
+    tag->SetPreampLevel(65536u);
+    parsed.SetOstDisc("2");
+    parsed.SetOstTrack("12c");
+    parsed.SetCopyrightYear("1994");
+    parsed.SetIntroLength("64000");
+    parsed.SetLoopLength("128000");
+    parsed.SetEndLength("32000");
+    parsed.SetFadeLengthExt("16000");
+    parsed.SetLoopTimes("3");
+    parsed.SetPreampLevel("65536");
+
+    EXPECT_EQ(tag->OstDisc().Value(), parsed.OstDisc().Value());
+    EXPECT_EQ(tag->OstTrack().Value(), parsed.OstTrack().Value());
+    EXPECT_EQ(tag->CopyrightYear().Value(), parsed.CopyrightYear().Value());
+    EXPECT_EQ(tag->IntroLength().Value(), parsed.IntroLength().Value());
+    EXPECT_EQ(tag->LoopLength().Value(), parsed.LoopLength().Value());
+    EXPECT_EQ(tag->EndLength().Value(), parsed.EndLength().Value());
+    EXPECT_EQ(tag->FadeLengthExt().Value(), parsed.FadeLengthExt().Value());
+    EXPECT_EQ(tag->LoopTimes().Value(), parsed.LoopTimes().Value());
+    EXPECT_EQ(tag->PreampLevel().Value(), parsed.PreampLevel().Value());
+
+    EXPECT_EQ(parsed.OstDiscValue(), 2);
+    EXPECT_EQ(parsed.OstTrackValue(), 12);
+    EXPECT_EQ(parsed.CopyrightYearValue(), 1994);
+    EXPECT_EQ(parsed.IntroLengthValue(), 64000u);
+    EXPECT_EQ(parsed.LoopLengthValue(), 128000u);
+    EXPECT_EQ(parsed.EndLengthValue(), 32000u);
+    EXPECT_EQ(parsed.FadeLengthExtValue(), 16000u);
+    EXPECT_EQ(parsed.LoopTimesValue(), 3);
+    EXPECT_EQ(parsed.PreampLevelValue(), 65536u);
+}
+
+TEST_F(ID666TagTests, GetsMissingTypedValuesAsEmpty)
+{
+    EXPECT_FALSE(tag->SongLengthValue().has_value());
+    EXPECT_FALSE(tag->FadeLengthValue().has_value());
+    EXPECT_FALSE(tag->DateDumpedValue().has_value());
+    EXPECT_FALSE(tag->OstDiscValue().has_value());
+    EXPECT_FALSE(tag->OstTrackValue().has_value());
+    EXPECT_FALSE(tag->CopyrightYearValue().has_value());
+    EXPECT_FALSE(tag->IntroLengthValue().has_value());
+    EXPECT_FALSE(tag->LoopTimesValue().has_value());
+    EXPECT_FALSE(tag->PreampLevelValue().has_value());
+}
+
+TEST_F(ID666TagTests, GetsZeroLengthsAsEmptyOnlyInBinaryTags)
+{
+    Spc::Id666::Tag text;
+    Spc::Id666::Tag binary;
+    std::memcpy(text.FieldData()->RawData(), textData, Spc::Id666::tagSize);
+    std::memcpy(binary.FieldData()->RawData(), 
+                binaryData, 
+                Spc::Id666::tagSize);
+
+    for (Spc::Id666::Tag* typed : { &text, &binary })
+    {
+        typed->SetSongLength(0u);
+        typed->SetFadeLength(0u);
+    }
+
+    EXPECT_EQ(text.SongLengthValue(), 0u);
+    EXPECT_EQ(text.FadeLengthValue(), 0u);
+    EXPECT_FALSE(binary.SongLengthValue().has_value());
+    EXPECT_FALSE(binary.FadeLengthValue().has_value());
+}
+
+TEST_F(ID666TagTests, TypedSettersEnforcePreconditions)
+{
+    EXPECT_THROW(tag->SetSongLength(960u), std::out_of_range);
+    EXPECT_THROW(tag->SetFadeLength(60000u), std::out_of_range);
+    EXPECT_THROW(tag->SetDateDumped(Spc::Date{ 2000, 13, 1 }), 
+                 std::invalid_argument);
+    EXPECT_THROW(tag->SetDateDumped(Spc::Date{ 2000, 1, 0 }), 
+                 std::invalid_argument);
+    EXPECT_THROW(tag->SetOstDisc(uint8_t{ 10 }), std::out_of_range);
+    EXPECT_THROW(tag->SetOstTrack(100), std::out_of_range);
+    EXPECT_THROW(tag->SetIntroLength(384000000u), std::out_of_range);
+    EXPECT_THROW(tag->SetPreampLevel(1u), std::out_of_range);
+    EXPECT_EQ(tag->ExtendedData()->ostDisc, nullptr);
+    EXPECT_EQ(tag->ExtendedData()->introLength, nullptr);
+}
+
+// The field based tag type detection that Tag::DetermineType() replaced, used
+// as a reference for both of its byte classification kernels.
+static Spc::Id666::TagType ReferenceTagType(const char* data)
+{
+    using namespace Spc::Id666;
+
+    auto read = [data](Spc::Field& field)
+    {
+        std::memcpy(field.RawData(), data + field.Offset() - tagOffset,
+                    field.Size());
+    };
+
+    Spc::DateField date{ "Date", dateDumpedInfo.binary };
+    Spc::NumericField songLength{ "Song", songLengthInfo.binary };
+    Spc::NumericField fadeLength{ "Fade", fadeLengthInfo.binary };
+    Spc::NumericField unused{ "Unused", Spc::FieldInfo{
+        dateDumpedInfo.binary.offset + 4, dateDumpedInfo.binary.size - 4 } };
+    Spc::NumericField reserved{ "Reserved", reservedInfo.binary };
+    read(date);
+    read(songLength);
+    read(fadeLength);
+    read(unused);
+    read(reserved);
+    const char* artist = data + songArtistInfo.binary.offset - tagOffset;
+
+    if (date.IsText() && songLength.IsText() && fadeLength.IsText())
+    {
+        return TagType::Text;
+    }
+
+    if ((date.IsSet() && !unused.IsZero()) ||
+        (artist[0] == 0 && artist[1] != 0) || !reserved.IsZero())
+    {
+        return TagType::TextMixed;
+    }
+
+    return TagType::Binary;
+}
+
+TEST_F(ID666TagTests, DeterminesTypeLikeFieldBasedDetection)
+{
+    using Spc::Id666::tagSize;
+
+    // Mutate the fixtures with bytes from each class the detection looks
+    // for, so every branch is taken many times.
+    const char interesting[]{ 0, 0, 0, '0', '5', '9', '/', 'A', ' ',
+                              0x2F, 0x3A, 0x7F, char(0x80), char(0xFF) };
+    std::mt19937 random{ 666 };
+    std::uniform_int_distribution<size_t> offset{ 0x70, tagSize - 1 };
+    std::uniform_int_distribution<size_t> pick{ 0, sizeof(interesting) - 1 };
+    std::uniform_int_distribution<int> mutations{ 0, 6 };
+    std::vector<char> data(tagSize);
+
+    for (int i = 0; i < 3000; i++)
+    {
+        const char* fixtures[]{ textData, binaryData, mixedData };
+        std::memcpy(data.data(), fixtures[i % 3], tagSize);
+
+        for (int m = mutations(random); m > 0; m--)
+        {
+            data[offset(random)] = interesting[pick(random)];
+        }
+
+        const Spc::ByteView bytes{ data.data(), data.size() };
+        const Spc::Id666::TagType expected = ReferenceTagType(data.data());
+
+        ASSERT_EQ(Spc::Id666::Tag::DetermineType(bytes), expected)
+            << "iteration " << i;
+        ASSERT_EQ(Spc::Id666::Tag::DetermineTypeScalar(bytes), expected)
+            << "iteration " << i;
+    }
+}
+
+TEST_F(ID666TagTests, GetsAndSetsFieldsByDescriptor)
+{
+    Spc::Id666::Tag tag;
+
+    tag.SetFieldValue(Spc::Id666::songTitleField, "Title");
+    tag.SetFieldValue(Spc::Id666::ostTrackField, "12b");
+    tag.SetFieldValue(Spc::Id666::copyrightYearField, "1995");
+
+    EXPECT_EQ(tag.SongTitle().Value(), "Title");
+    EXPECT_EQ(tag.OstTrack().Value(), tag.FieldValue(
+        Spc::Id666::ostTrackField));
+    EXPECT_EQ(tag.CopyrightYearValue(), 1995);
+
+    for (const Spc::Id666::FieldDescriptor* field : 
+         Spc::Id666::fieldDescriptors)
+    {
+        EXPECT_NO_THROW(tag.FieldValue(*field)) << field->label;
+    }
+
+    const Spc::Id666::FieldDescriptor unknown{ Spc::Id666::songTitleField };
+
+    EXPECT_THROW(tag.FieldValue(unknown), std::invalid_argument);
+    EXPECT_THROW(tag.SetFieldValue(Spc::Id666::ostDiscField, "10"), 
+                 std::out_of_range);
+}
@@ -17,6 +17,7 @@
 #ifndef ID666_TAG_TESTS_H
 #define ID666_TAG_TESTS_H
 
+#include <random>
 #include <vector>
 #include <string>
 #include <gtest/gtest.h>
@@ -0,0 +1,129 @@
+// LayoutTests.cpp - Defines the LayoutTests tests.
+//
+// Copyright (C) 2026 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "LayoutTests.h"
+
+#include <chrono>
+#include <fstream>
+#include <string>
+
+using Spc::Id666::Pattern::Compiled;
+
+void LayoutTests::SetUp()
+{
+    namespace fs = std::filesystem;
+
+    const auto ticks = std::chrono::steady_clock::now().time_since_epoch();
+    tempDir = fs::temp_directory_path() / 
+              ("libcppspc-layout-" + std::to_string(ticks.count()));
+    fs::create_directories(tempDir);
+}
+
+void LayoutTests::TearDown()
+{
+    std::filesystem::remove_all(tempDir);
+}
+
+TEST_F(LayoutTests, BuildsDestinationUnderRoot)
+{
+    Spc::Layout layout{ Compiled{ "%game%/%disc%-%track:02% %song%.spc" }, 
+                        tempDir };
+    Spc::Id666::Tag tag;
+    tag.SetGameTitle("Game");
+    tag.SetOstDisc("1");
+    tag.SetOstTrack("3");
+    tag.SetSongTitle("Intro");
+
+    auto destination = layout.Destination(tag);
+
+    ASSERT_TRUE(layout.IsValid());
+    ASSERT_TRUE(destination.has_value());
+    EXPECT_EQ(*destination, tempDir / "Game" / "1-03 Intro.spc");
+    EXPECT_FALSE(std::filesystem::exists(tempDir / "Game"));
+}
+
+TEST_F(LayoutTests, SanitizesSeparatorsInValues)
+{
+    Spc::Layout layout{ Compiled{ "%artist%/%song%.spc" }, tempDir };
+    Spc::Id666::Tag tag;
+    tag.SetSongArtist("AC/DC");
+    tag.SetSongTitle("..\\..:x");
+
+    auto destination = layout.Destination(tag);
+
+    ASSERT_TRUE(destination.has_value());
+    EXPECT_EQ(*destination, tempDir / "AC_DC" / ".._.._x.spc");
+}
+
+TEST_F(LayoutTests, RejectsUnsafePaths)
+{
+    Spc::Id666::Tag tag;
+    tag.SetSongTitle("Intro");
+
+    EXPECT_FALSE(Spc::Layout(Compiled{ "/%song%" }, tempDir).IsValid());
+    EXPECT_FALSE(Spc::Layout(Compiled{ "a\\%song%" }, tempDir).IsValid());
+    EXPECT_FALSE(Spc::Layout(Compiled{ "%mood%/x" }, tempDir).IsValid());
+
+    // An empty value leaves an empty directory name, and literals may not 
+    // climb out of the root either.
+    EXPECT_FALSE(Spc::Layout(Compiled{ "%game%/%song%" }, tempDir)
+                     .Destination(tag).has_value());
+    EXPECT_FALSE(Spc::Layout(Compiled{ "../%song%" }, tempDir)
+                     .Destination(tag).has_value());
+    EXPECT_FALSE(Spc::Layout(Compiled{ "%song%/./x" }, tempDir)
+                     .Destination(tag).has_value());
+}
+
+TEST_F(LayoutTests, CreatesEachDirectoryOnce)
+{
+    Spc::Layout layout{ Compiled{ "%game%/%disc%/%track%.spc" }, tempDir };
+    Spc::Id666::Tag tag;
+    tag.SetGameTitle("Game");
+    tag.SetOstDisc("1");
+
+    for (int track = 1; track <= 3; track++)
+    {
+        tag.SetOstTrack(std::to_string(track));
+        ASSERT_TRUE(layout.Prepare(tag).has_value());
+    }
+
+    const size_t known = layout.KnownDirectories();
+    EXPECT_TRUE(std::filesystem::is_directory(tempDir / "Game" / "1"));
+
+    // A new disc only adds its own directory, since the game's directory
+    // is already known.
+    tag.SetOstDisc("2");
+    ASSERT_TRUE(layout.Prepare(tag).has_value());
+
+    EXPECT_EQ(layout.KnownDirectories(), known + 1);
+    EXPECT_TRUE(std::filesystem::is_directory(tempDir / "Game" / "2"));
+}
+
+TEST_F(LayoutTests, FailsWhenDirectoryIsAFile)
+{
+    {
+        std::ofstream blocker(tempDir / "Game");
+        blocker << "not a directory";
+    }
+
+    Spc::Layout layout{ Compiled{ "%game%/%song%.spc" }, tempDir };
+    Spc::Id666::Tag tag;
+    tag.SetGameTitle("Game");
+    tag.SetSongTitle("Intro");
+
+    EXPECT_FALSE(layout.Prepare(tag).has_value());
+}
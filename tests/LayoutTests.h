@@ -0,0 +1,35 @@
+// LayoutTests.h - Declares the LayoutTests class.
+//
+// Copyright (C) 2026 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#ifndef LAYOUT_TESTS_H
+#define LAYOUT_TESTS_H
+
+#include <filesystem>
+#include <gtest/gtest.h>
+#include "LibCppSpc.h"
+
+class LayoutTests : public ::testing::Test
+{
+protected:
+    void SetUp() override;
+
+    void TearDown() override;
+
+    std::filesystem::path tempDir;
+};
+
+#endif
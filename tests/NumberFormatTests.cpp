@@ -0,0 +1,77 @@
+// NumberFormatTests.cpp - Defines the NumberFormatTests class and tests.
+//
+// Copyright (C) 2026 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "NumberFormatTests.h"
+
+void NumberFormatTests::SetUp()
+{
+    // No setup needed for these tests.
+}
+
+TEST_F(NumberFormatTests, FormatsIntegersProperly)
+{
+    EXPECT_EQ(Spc::FormatInteger(0), "0");
+    EXPECT_EQ(Spc::FormatInteger(-42), "-42");
+    EXPECT_EQ(Spc::FormatInteger(4294967295), "4294967295");
+}
+
+TEST_F(NumberFormatTests, FormatsPaddedIntegersProperly)
+{
+    char text[Spc::maxIntegerDigits];
+
+    ASSERT_EQ(Spc::FormatPadded(7, 2, text), 2u);
+    EXPECT_EQ(std::string(text, 2), "07");
+    ASSERT_EQ(Spc::FormatPadded(2000, 4, text), 4u);
+    EXPECT_EQ(std::string(text, 4), "2000");
+    ASSERT_EQ(Spc::FormatPadded(123, 2, text), 3u);
+    EXPECT_EQ(std::string(text, 3), "123");
+}
+
+TEST_F(NumberFormatTests, WritesDigitsIntoFixedSizeField)
+{
+    char field[5]{ 'x', 'x', 'x', 'x', 'x' };
+
+    Spc::WriteDigits(123, field, sizeof(field));
+    EXPECT_EQ(std::string(field, sizeof(field)), std::string("123\0\0", 5));
+
+    Spc::WriteDigits(1234567, field, 3);
+    EXPECT_EQ(std::string(field, 3), "123");
+}
+
+TEST_F(NumberFormatTests, ParsesIntegersLikeStoi)
+{
+    EXPECT_EQ(Spc::ParseInt32("123"), 123);
+    EXPECT_EQ(Spc::ParseInt32("  -45"), -45);
+    EXPECT_EQ(Spc::ParseInt32("+7"), 7);
+    EXPECT_EQ(Spc::ParseInt32("12abc"), 12);
+    EXPECT_EQ(Spc::ParseInt32("0101", 2), 5);
+    EXPECT_THROW(Spc::ParseInt32(""), std::invalid_argument);
+    EXPECT_THROW(Spc::ParseInt32("abc"), std::invalid_argument);
+    EXPECT_THROW(Spc::ParseInt32("+-1"), std::invalid_argument);
+    EXPECT_THROW(Spc::ParseInt32("2147483648"), std::out_of_range);
+}
+
+TEST_F(NumberFormatTests, ParsesLimitedDigits)
+{
+    uint32_t value{ 0 };
+
+    EXPECT_EQ(Spc::ParseDigits("02/06", 2, value), 2u);
+    EXPECT_EQ(value, 2u);
+    EXPECT_EQ(Spc::ParseDigits("20001", 4, value), 4u);
+    EXPECT_EQ(value, 2000u);
+    EXPECT_EQ(Spc::ParseDigits("-1", 2, value), 0u);
+    EXPECT_EQ(Spc::ParseDigits("", 2, value), 0u);
+}
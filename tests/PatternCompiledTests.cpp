@@ -0,0 +1,304 @@
+// PatternCompiledTests.cpp - Defines the PatternCompiledTests tests.
+//
+// Copyright (C) 2026 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "PatternCompiledTests.h"
+
+#include <map>
+#include <memory>
+#include <string>
+
+using namespace Spc::Id666::Pattern;
+
+void PatternCompiledTests::SetUp()
+{
+    // No setup needed for these tests.
+}
+
+TEST_F(PatternCompiledTests, ResolvesPlaceholdersToFields)
+{
+    Compiled pattern{ "%track% - %song% (%game%).spc" };
+    const std::vector<Segment>& segments = pattern.Segments();
+
+    ASSERT_EQ(segments.size(), 7);
+    EXPECT_TRUE(pattern.IsValid());
+
+    EXPECT_EQ(segments[0].type, NodeType::NumericPlaceholder);
+    EXPECT_EQ(segments[0].field, &Spc::Id666::ostTrackField);
+    EXPECT_EQ(segments[1].type, NodeType::Literal);
+    EXPECT_EQ(segments[1].lexeme, " - ");
+    EXPECT_EQ(segments[1].field, nullptr);
+    EXPECT_EQ(segments[2].type, NodeType::TextPlaceholder);
+    EXPECT_EQ(segments[2].field, &Spc::Id666::songTitleField);
+    EXPECT_EQ(segments[4].field, &Spc::Id666::gameTitleField);
+    EXPECT_EQ(segments[6].type, NodeType::End);
+}
+
+TEST_F(PatternCompiledTests, IsInvalidWithUnsupportedPlaceholder)
+{
+    Compiled pattern{ "%track% - %mood%.spc" };
+
+    EXPECT_FALSE(pattern.IsValid());
+    EXPECT_EQ(pattern.Segments()[2].lexeme, "%mood%");
+    EXPECT_EQ(pattern.Segments()[2].field, nullptr);
+}
+
+TEST_F(PatternCompiledTests, IsInvalidWithMalformedFormat)
+{
+    EXPECT_FALSE(Compiled{ "%track:x2%.spc" }.IsValid());
+    EXPECT_FALSE(Compiled{ "%track:-02%.spc" }.IsValid());
+    EXPECT_TRUE(Compiled{ "%track:02%.spc" }.IsValid());
+}
+
+TEST_F(PatternCompiledTests, HasAPlaceholderForEveryField)
+{
+    for (const Spc::Id666::FieldDescriptor* field : 
+         Spc::Id666::fieldDescriptors)
+    {
+        bool found{ false };
+
+        for (const Placeholder& placeholder : placeholders)
+        {
+            found = found || placeholder.field == field;
+        }
+
+        EXPECT_TRUE(found) << field->label;
+    }
+
+    Compiled pattern{ "%dumper% %year:04% %preamp%" };
+
+    ASSERT_TRUE(pattern.IsValid());
+    EXPECT_EQ(pattern.Segments()[0].field, &Spc::Id666::dumperNameField);
+    EXPECT_EQ(pattern.Segments()[2].type, NodeType::NumericPlaceholder);
+    EXPECT_EQ(pattern.Segments()[2].field, &Spc::Id666::copyrightYearField);
+    EXPECT_EQ(pattern.Segments()[2].format.width, 4);
+    EXPECT_EQ(pattern.Segments()[2].format.fill, '0');
+    EXPECT_EQ(pattern.Segments()[4].field, &Spc::Id666::preampLevelField);
+}
+
+TEST_F(PatternCompiledTests, OutlivesThePatternString)
+{
+    auto text = std::make_unique<std::string>("%disc%-%artist%");
+    Compiled pattern{ *text };
+    text.reset();
+
+    EXPECT_EQ(pattern.Source(), "%disc%-%artist%");
+    EXPECT_EQ(pattern.Segments()[0].lexeme, "%disc%");
+    EXPECT_EQ(pattern.Segments()[1].lexeme, "-");
+    EXPECT_EQ(pattern.Segments()[2].field, &Spc::Id666::songArtistField);
+}
+
+TEST_F(PatternCompiledTests, MatchesEveryPlaceholderInOnePass)
+{
+    Compiled pattern{ "%game% - %track% - %song%.spc" };
+
+    auto captures = pattern.Match("Game - 12b - Song.spc");
+
+    ASSERT_TRUE(captures.has_value());
+    ASSERT_EQ(captures->size(), 3);
+    EXPECT_EQ((*captures)[0].field, &Spc::Id666::gameTitleField);
+    EXPECT_EQ((*captures)[0].value, "Game");
+    EXPECT_EQ((*captures)[1].field, &Spc::Id666::ostTrackField);
+    EXPECT_EQ((*captures)[1].value, "12b");
+    EXPECT_EQ((*captures)[2].value, "Song");
+}
+
+TEST_F(PatternCompiledTests, BacktracksWhenSeparatorAppearsInValue)
+{
+    Compiled pattern{ "%song% - %track%.spc" };
+
+    auto captures = pattern.Match("Intro - Part 2 - 03.spc");
+
+    ASSERT_TRUE(captures.has_value());
+    EXPECT_EQ((*captures)[0].value, "Intro - Part 2");
+    EXPECT_EQ((*captures)[1].value, "03");
+}
+
+TEST_F(PatternCompiledTests, PrefersShortestTextAndLongestNumber)
+{
+    Compiled separated{ "%game% - %song%.spc" };
+    auto text = separated.Match("A - B - C.spc");
+
+    ASSERT_TRUE(text.has_value());
+    EXPECT_EQ((*text)[0].value, "A");
+    EXPECT_EQ((*text)[1].value, "B - C");
+
+    Compiled adjacent{ "%disc%%song%.spc" };
+    auto numbers = adjacent.Match("12Title.spc");
+
+    ASSERT_TRUE(numbers.has_value());
+    EXPECT_EQ((*numbers)[0].value, "12");
+    EXPECT_EQ((*numbers)[1].value, "Title");
+}
+
+TEST_F(PatternCompiledTests, FailsToMatchWhenFileNameDiffers)
+{
+    Compiled pattern{ "%game%-%track%.spc" };
+
+    EXPECT_FALSE(pattern.Match("Game-Track.spc").has_value());
+    EXPECT_FALSE(pattern.Match("Game-1.spc.bak").has_value());
+    EXPECT_FALSE(pattern.Match("Game1.spc").has_value());
+    EXPECT_FALSE(Compiled{ "%mood%.spc" }.Match("Sad.spc").has_value());
+}
+
+TEST_F(PatternCompiledTests, MatchesPaddedPlaceholders)
+{
+    Compiled pattern{ "%track:02% %disc:3%-%song:-8%.spc" };
+
+    auto captures = pattern.Match("07   1-Intro   .spc");
+
+    ASSERT_TRUE(captures.has_value());
+    EXPECT_EQ((*captures)[0].value, "07");
+    EXPECT_EQ((*captures)[1].value, "1");
+    EXPECT_EQ((*captures)[2].value, "Intro");
+
+    Compiled left{ "%track:-3%.spc" };
+    auto track = left.Match("9b .spc");
+
+    ASSERT_TRUE(track.has_value());
+    EXPECT_EQ((*track)[0].value, "9b");
+}
+
+TEST_F(PatternCompiledTests, FormatsTagIntoReusedBuffer)
+{
+    Spc::Id666::Tag tag;
+    tag.SetOstTrack("7");
+    tag.SetSongTitle("Intro");
+    tag.SetCopyrightYear("1995");
+    tag.SetDumperName("Dumper");
+
+    Compiled pattern{ "%track:02% - %song:-7%(%year%) %dumper:8%.spc" };
+    std::string output{ "previous contents" };
+
+    ASSERT_TRUE(pattern.Format(tag, output));
+    EXPECT_EQ(output, "07 - Intro  (1995)   Dumper.spc");
+
+    tag.SetSongTitle("Long Song Title");
+
+    ASSERT_TRUE(pattern.Format(tag, output));
+    EXPECT_EQ(output, "07 - Long Song Title(1995)   Dumper.spc");
+
+    // A shorter file name fits in the space the longer one left behind.
+    const char* buffer = output.data();
+    tag.SetSongTitle("Short");
+
+    ASSERT_TRUE(pattern.Format(tag, output));
+    EXPECT_EQ(output, "07 - Short  (1995)   Dumper.spc");
+    EXPECT_EQ(output.data(), buffer);
+    EXPECT_FALSE(Compiled{ "%mood%" }.Format(tag, output));
+    EXPECT_TRUE(output.empty());
+}
+
+TEST_F(PatternCompiledTests, MatchesTextLikePlaceholdersAsText)
+{
+    auto date = Compiled{ "%date% %song%" }.Match("10-17-2026 A");
+    auto emulator = Compiled{ "%emulator% - %song%" }.Match("ZSNES - A");
+    auto muted = Compiled{ "%muted%" }.Match("00001111");
+
+    ASSERT_TRUE(date.has_value());
+    EXPECT_EQ((*date)[0].value, "10-17-2026");
+    ASSERT_TRUE(emulator.has_value());
+    EXPECT_EQ((*emulator)[0].value, "ZSNES");
+    ASSERT_TRUE(muted.has_value());
+    EXPECT_EQ((*muted)[0].value, "00001111");
+}
+
+TEST_F(PatternCompiledTests, RoundTripsEveryPlaceholder)
+{
+    using namespace Spc::Id666;
+
+    const std::map<const FieldDescriptor*, std::string> samples
+    {
+        { &songTitleField, "Song" },
+        { &gameTitleField, "Game" },
+        { &dumperNameField, "Dumper" },
+        { &commentsField, "Comments" },
+        { &dateDumpedField, "10/17/2026" },
+        { &songLengthField, "120" },
+        { &fadeLengthField, "5000" },
+        { &songArtistField, "Artist" },
+        { &defaultDisabledChannelsField, "00001111" },
+        { &emulatorUsedField, "ZSNES" },
+        { &ostTitleField, "OST" },
+        { &ostDiscField, "2" },
+        { &ostTrackField, "12b" },
+        { &publisherNameField, "Publisher" },
+        { &copyrightYearField, "1995" },
+        { &introLengthField, "1000" },
+        { &loopLengthField, "2000" },
+        { &endLengthField, "3000" },
+        { &fadeLengthExtField, "4000" },
+        { &mutedVoicesField, "11110000" },
+        { &loopTimesField, "3" },
+        { &preampLevelField, "65536" }
+    };
+
+    Tag tag;
+
+    for (const auto& [field, value] : samples)
+    {
+        tag.SetFieldValue(*field, value);
+    }
+
+    for (const Placeholder& placeholder : placeholders)
+    {
+        const FieldDescriptor& field = *placeholder.field;
+        Compiled pattern{ std::string{ "x " } + placeholder.name + ".spc" };
+        std::string fileName;
+
+        ASSERT_TRUE(pattern.Format(tag, fileName)) << placeholder.name;
+        EXPECT_EQ(fileName.find('/'), std::string::npos) << placeholder.name;
+
+        auto captures = pattern.Match(fileName);
+
+        ASSERT_TRUE(captures.has_value()) << placeholder.name;
+
+        Tag matched;
+        matched.SetFieldValue(field, FileNameToTagValue(
+            field, (*captures)[0].value));
+
+        EXPECT_EQ(matched.FieldValue(field), tag.FieldValue(field)) 
+            << placeholder.name;
+    }
+}
+
+TEST_F(PatternCompiledTests, RoundTripsDateBeforeSeparatorLiteral)
+{
+    using namespace Spc::Id666;
+
+    Tag tag;
+    tag.SetDateDumped("01/02/2025");
+    tag.SetSongTitle("Intro-Theme");
+
+    Compiled pattern{ "%date%-%song%.spc" };
+    std::string fileName;
+
+    ASSERT_TRUE(pattern.Format(tag, fileName));
+    EXPECT_EQ(fileName, "01-02-2025-Intro-Theme.spc");
+
+    auto captures = pattern.Match(fileName);
+
+    ASSERT_TRUE(captures.has_value());
+    ASSERT_EQ(captures->size(), 2);
+    EXPECT_EQ((*captures)[0].value, "01-02-2025");
+    EXPECT_EQ((*captures)[1].value, "Intro-Theme");
+
+    Tag matched;
+    matched.SetFieldValue(dateDumpedField, FileNameToTagValue(
+        dateDumpedField, (*captures)[0].value));
+
+    EXPECT_EQ(matched.DateDumped().Value(), "01/02/2025");
+    EXPECT_FALSE(pattern.Match("01-02-Intro.spc").has_value());
+}
@@ -0,0 +1,75 @@
+// PatternFormatSpecTests.cpp - Defines the PatternFormatSpecTests tests.
+//
+// Copyright (C) 2026 Stephen Bonar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http ://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "PatternFormatSpecTests.h"
+
+#include <string>
+
+using namespace Spc::Id666::Pattern;
+
+void PatternFormatSpecTests::SetUp()
+{
+    // No setup needed for these tests.
+}
+
+TEST_F(PatternFormatSpecTests, ParsesWidthAndFlags)
+{
+    auto plain = ParseFormat("");
+    auto zeros = ParseFormat("02");
+    auto spaces = ParseFormat("3");
+    auto left = ParseFormat("-20");
+
+    ASSERT_TRUE(plain && zeros && spaces && left);
+    EXPECT_EQ(plain->width, 0);
+    EXPECT_EQ(zeros->width, 2);
+    EXPECT_EQ(zeros->fill, '0');
+    EXPECT_FALSE(zeros->leftAlign);
+    EXPECT_EQ(spaces->width, 3);
+    EXPECT_EQ(spaces->fill, ' ');
+    EXPECT_EQ(left->width, 20);
+    EXPECT_TRUE(left->leftAlign);
+}
+
+TEST_F(PatternFormatSpecTests, RejectsInvalidFormats)
+{
+    EXPECT_FALSE(ParseFormat("-").has_value());
+    EXPECT_FALSE(ParseFormat("0").has_value());
+    EXPECT_FALSE(ParseFormat("-02").has_value());
+    EXPECT_FALSE(ParseFormat("2x").has_value());
+    EXPECT_FALSE(ParseFormat("256").has_value());
+    EXPECT_TRUE(ParseFormat("255").has_value());
+}
+
+TEST_F(PatternFormatSpecTests, AppendsPaddedValues)
+{
+    std::string output{ "[" };
+
+    ParseFormat("03")->Append(output, "7");
+    ParseFormat("-4")->Append(output, "ab");
+    ParseFormat("4")->Append(output, "cd");
+    ParseFormat("2")->Append(output, "long");
+
+    EXPECT_EQ(output, "[007ab    cdlong");
+}
+
+TEST_F(PatternFormatSpecTests, TrimsOnlySpacePadding)
+{
+    EXPECT_EQ(ParseFormat("4")->Trim("  cd"), "cd");
+    EXPECT_EQ(ParseFormat("-4")->Trim("ab  "), "ab");
+    EXPECT_EQ(ParseFormat("03")->Trim("007"), "007");
+    EXPECT_EQ(ParseFormat("")->Trim(" x "), " x ");
+}
@@ -50,4 +50,18 @@ TEST_F(PatternTokenTests, IdentifiesEndOfPatternToken)
     Spc::Id666::Pattern::Token token;
 
     EXPECT_EQ(token.Type(), Spc::Id666::Pattern::TokenType::End);
-}
\ No newline at end of file
+}
+
+TEST_F(PatternTokenTests, SplitsPlaceholderIntoNameAndFormat)
+{
+    Spc::Id666::Pattern::Token formatted{ "%track:02%" };
+    Spc::Id666::Pattern::Token plain{ "%song%" };
+    Spc::Id666::Pattern::Token literal{ "track:02" };
+
+    EXPECT_EQ(formatted.Name(), "track");
+    EXPECT_EQ(formatted.Format(), "02");
+    EXPECT_EQ(plain.Name(), "song");
+    EXPECT_EQ(plain.Format(), "");
+    EXPECT_EQ(literal.Name(), "");
+    EXPECT_EQ(literal.Format(), "");
+}